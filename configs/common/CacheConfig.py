@@ -76,10 +76,78 @@ def _get_cache_opts(level, options):
     if hasattr(options, prefetcher_attr):
         opts["prefetcher"] = _get_hwp(getattr(options, prefetcher_attr))
 
+    if getattr(options, "cache_snapshot", False):
+        opts["warmup_snapshot"] = True
+
     return opts
 
 
 
+def _parse_partitions(arg, convert):
+    ids, values = [], []
+    for pair in arg.split(","):
+        partition_id, value = pair.split(":")
+        ids.append(int(partition_id, 0))
+        values.append(convert(value))
+    return ids, values
+
+
+def _config_l3_partitioning(options, l3):
+    if options.l3_sector_tags:
+        l3.tags = SectorTags()
+
+    policies = []
+    if options.l3_way_partitions:
+        ids, masks = _parse_partitions(
+            options.l3_way_partitions, lambda mask: int(mask, 0)
+        )
+        policies.append(
+            WayPartitioningPolicy(partition_ids=ids, way_masks=masks)
+        )
+    if options.l3_capacity_partitions:
+        ids, shares = _parse_partitions(options.l3_capacity_partitions, float)
+        policies.append(
+            MaxCapacityPartitioningPolicy(partition_ids=ids, capacities=shares)
+        )
+
+    if policies:
+        l3.tags.partition_manager = PartitionManager(
+            partition_key="partition_by_" + options.l3_partition_key,
+            partitioning_policies=policies,
+        )
+
+
+def _bridge_uncached_ports(options, system, cpu, eventq_index):
+    # Interrupt ports of a core living on its own event queue reach the
+    # shared buses through one ThreadBridge each.
+    uncached_in = system.membus.cpu_side_ports
+    uncached_out = (
+        system.membus.mem_side_ports
+        if not options.maa
+        else system.membusnc.mem_side_ports
+    )
+    bridges = []
+    for p in cpu._uncached_interrupt_request_ports:
+        bridge = ThreadBridge(
+            eventq_index=0,
+            in_eventq_index=eventq_index,
+            delay=options.sim_quantum,
+        )
+        exec(f"bridge.in_port = cpu.{p}")
+        bridge.out_port = uncached_in
+        bridges.append(bridge)
+    for p in cpu._uncached_interrupt_response_ports:
+        bridge = ThreadBridge(
+            eventq_index=eventq_index,
+            in_eventq_index=0,
+            delay=options.sim_quantum,
+        )
+        bridge.in_port = uncached_out
+        exec(f"cpu.{p} = bridge.out_port")
+        bridges.append(bridge)
+    cpu.int_bridges = bridges
+
+
 def config_3L_cache(options, system):
     if options.external_memory_system:
         print("External caches and internal caches are exclusive options.\n")
@@ -142,6 +210,7 @@ def config_3L_cache(options, system):
         system.l3 = l3_cache_class(
             clk_domain=system.cpu_clk_domain, **_get_cache_opts("l3", options)
         )
+        _config_l3_partitioning(options, system.l3)
 
         if options.cpu_buffer_enlarge_factor != 1:
             print("Enlarging Cache buffers by a factor of %d" % options.cpu_buffer_enlarge_factor)
@@ -149,9 +218,30 @@ def config_3L_cache(options, system):
             system.l3.write_buffers = system.l3.write_buffers * options.cpu_buffer_enlarge_factor
 
         system.tol3bus = L3XBar(clk_domain=system.cpu_clk_domain)
+        if options.l3_sf_entries:
+            system.tol3bus.snoop_filter.entries = options.l3_sf_entries
+            system.tol3bus.snoop_filter.assoc = options.l3_sf_assoc
+            system.tol3bus.snoop_filter.replacement_policy = LRURP()
         system.l3.cpu_side = system.tol3bus.mem_side_ports
         system.l3.mem_side = system.membus.cpu_side_ports
 
+    if options.eventq_per_core:
+        # Each core and its private caches run on event queue i + 1, the
+        # L3, the MAA and memory stay on event queue 0. The L2-to-L3
+        # bridges add a crossing latency of one simulation quantum.
+        print(
+            "Partitioning %d cores on their own event queues (quantum %s)"
+            % (options.num_cpus, options.sim_quantum)
+        )
+        system.l2_bridges = [
+            ThreadBridge(
+                eventq_index=0,
+                in_eventq_index=i + 1,
+                delay=options.sim_quantum,
+            )
+            for i in range(options.num_cpus)
+        ]
+
     for i in range(options.num_cpus):
         icache = icache_class(**_get_cache_opts("l1i", options))
         dcache = dcache_class(**_get_cache_opts("l1d", options))
@@ -250,11 +340,17 @@ def config_3L_cache(options, system):
         )
 
         system.cpu[i].createInterruptController()
-        system.cpu[i].connectAllPorts(
-            system.tol3bus.cpu_side_ports,
-            system.membus.cpu_side_ports,
-            system.membus.mem_side_ports if not options.maa else system.membusnc.mem_side_ports,
-        )
+        if options.eventq_per_core:
+            system.cpu[i].eventq_index = i + 1
+            system.cpu[i].connectCachedPorts(system.l2_bridges[i].in_port)
+            system.l2_bridges[i].out_port = system.tol3bus.cpu_side_ports
+            _bridge_uncached_ports(options, system, system.cpu[i], i + 1)
+        else:
+            system.cpu[i].connectAllPorts(
+                system.tol3bus.cpu_side_ports,
+                system.membus.cpu_side_ports,
+                system.membus.mem_side_ports if not options.maa else system.membusnc.mem_side_ports,
+            )
 
     return system
 
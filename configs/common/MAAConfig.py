@@ -189,3 +189,10 @@ def config_maa(options, system):
         print("MAA L3 uncacheable")
         for addr_range in opts["addr_ranges"]:
             system.l3.excl_addr_ranges.append(addr_range)
+
+    # Difference-matching prefetchers drop the prefetches the MAA already serves
+    for i in range(options.num_cpus):
+        for cache in [system.cpu[i].dcache, system.cpu[i].l2cache]:
+            if isinstance(cache.prefetcher, DiffMatchingPrefetcher):
+                print(f"MAA served ranges suppress CPU{i} DMP prefetches")
+                cache.prefetcher.set_maa(system.maa)
@@ -307,5 +307,15 @@ def config_mem(options, system):
             mem_ctrls[i].port = xbar.mem_side_ports
 
     subsystem.mem_ctrls = mem_ctrls
+
+    # Throttle the prefetchers with the occupancy of the controller queues,
+    # the prefetchers of a MultiPrefetcher are throttled through it
+    if getattr(options, "pf_throttle_interval", 0):
+        for obj in system.descendants():
+            if isinstance(obj, m5.objects.BasePrefetcher) and not isinstance(
+                obj.get_parent(), m5.objects.MultiPrefetcher
+            ):
+                obj.throttle_interval = options.pf_throttle_interval
+                obj.mem_ctrls = mem_ctrls
     
     print("Memory controllers created")
\ No newline at end of file
@@ -208,7 +208,67 @@ def addNoISAOptions(parser):
     parser.add_argument("--l1i_mshrs", type=int, default=16)
     parser.add_argument("--l2_mshrs", type=int, default=32)
     parser.add_argument("--l3_mshrs", type=int, default=64)
+    parser.add_argument(
+        "--l3_sf_entries",
+        type=int,
+        default=0,
+        help="Lines tracked by the snoop filter of the L2-to-L3 bus, "
+        "0 tracks every line without back-invalidations",
+    )
+    parser.add_argument("--l3_sf_assoc", type=int, default=16)
+    parser.add_argument(
+        "--l3_sector_tags",
+        action="store_true",
+        help="Use sector tags in the L3 cache",
+    )
+    parser.add_argument(
+        "--l3_partition_key",
+        choices=["region", "requestor"],
+        default="region",
+        help="Partition the L3 lines by memory region or requestor ID",
+    )
+    parser.add_argument(
+        "--l3_way_partitions",
+        type=str,
+        default="",
+        help="Ways each L3 partition may allocate in, as comma-separated "
+        "ID:MASK pairs, e.g. 0:0xf000,255:0x0fff",
+    )
+    parser.add_argument(
+        "--l3_capacity_partitions",
+        type=str,
+        default="",
+        help="Maximum share of the L3 lines of each partition, as "
+        "comma-separated ID:SHARE pairs, e.g. 0:0.25",
+    )
+    parser.add_argument(
+        "--cache-snapshot",
+        action="store_true",
+        help="Save the lines resident in the caches in checkpoints, and "
+        "reload them when restoring, to shorten the warmup",
+    )
+    parser.add_argument(
+        "--bp-functional-warmup",
+        action="store_true",
+        help="Share the branch predictor of the switched-in CPUs with the "
+        "fast-forwarding CPUs, so that it is trained during the fast "
+        "forward and saved in its checkpoints",
+    )
     parser.add_argument("--cacheline_size", type=int, default=64)
+    parser.add_argument(
+        "--eventq-per-core",
+        action="store_true",
+        help="Simulate each core and its private L1/L2 caches on its own "
+        "event queue (host thread), synchronized with the shared L3, MAA "
+        "and memory on event queue 0 every --sim-quantum",
+    )
+    parser.add_argument(
+        "--sim-quantum",
+        type=str,
+        default="10ns",
+        help="Simulation quantum for parallel simulation, also used as the "
+        "L2-to-L3 crossing latency. Default: %(default)s",
+    )
 
     parser.add_argument("--maa", action="store_true")
     parser.add_argument("--maa_num_tiles", type=int, default=32, help="Number of SPD tiles")
@@ -413,6 +473,14 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
                         (if not set, use the default prefetcher of
                         the selected cache)""",
     )
+    parser.add_argument(
+        "--pf-throttle-interval",
+        default=0,
+        type=int,
+        help="Prefetches issued per interval of the feedback-directed "
+        "throttling of every prefetcher, driven by the memory controller "
+        "queues too; 0 disables throttling",
+    )
     parser.add_argument(
         "--stride-degree",
         default=4,
@@ -649,6 +717,23 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
         help="restore from a simpoint checkpoint taken with "
         + "--take-simpoint-checkpoints",
     )
+    parser.add_argument(
+        "--fork-simpoints",
+        action="store",
+        type=str,
+        help="<simpoint file,weight file,interval-length,warmup-length> "
+        "Fast forward once through the SimPoints (counted from the "
+        "restored checkpoint, if any) and fork a child simulating each "
+        "of them with --cpu-type, then merge the weighted stats",
+    )
+    parser.add_argument(
+        "--fork-jobs",
+        action="store",
+        type=int,
+        default=0,
+        help="Number of SimPoint children running at once with "
+        "--fork-simpoints (0 for the number of host CPUs)",
+    )
 
     # Checkpointing options
     # Note that performing checkpointing via python script files will override
@@ -756,6 +841,43 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
         default=None,
         help="Number of instructions to fast forward before switching",
     )
+    parser.add_argument(
+        "--sample-period",
+        action="store",
+        type=int,
+        default=None,
+        help="Sample the simulation once every SAMPLE_PERIOD instructions, "
+        "fast forwarding functionally with --cpu-type only simulated "
+        "during the samples (after --fast-forward, if given)",
+    )
+    parser.add_argument(
+        "--sample-warmup",
+        action="store",
+        type=int,
+        default=2000,
+        help="Number of detailed warmup instructions before each sample",
+    )
+    parser.add_argument(
+        "--sample-length",
+        action="store",
+        type=int,
+        default=1000,
+        help="Number of instructions measured in each sample",
+    )
+    parser.add_argument(
+        "--sample-max",
+        action="store",
+        type=int,
+        default=None,
+        help="Stop after this number of samples",
+    )
+    parser.add_argument(
+        "--sample-confidence",
+        action="store",
+        type=float,
+        default=0.997,
+        help="Confidence level of the interval reported for the sampled CPI",
+    )
     parser.add_argument(
         "-S",
         "--simpoint",
@@ -879,6 +1001,14 @@ def addSEOptions(parser):
         action="store_true",
         help="Wait for remote GDB to connect.",
     )
+    parser.add_argument(
+        "--cow-image-segments",
+        default=False,
+        action="store_true",
+        help="Map the segments of the binary copy-on-write from its file "
+        "rather than copying them into memory, so that simulations of the "
+        "same binary share its pages on the host.",
+    )
 
 
 def addFSOptions(parser):
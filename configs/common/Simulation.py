@@ -37,9 +37,16 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import json
+import os
 import sys
 from os import getcwd
 from os.path import join as joinpath
+from statistics import (
+    NormalDist,
+    mean,
+    stdev,
+)
 
 from common import (
     CpuConfig,
@@ -80,7 +87,9 @@ def setCPUClass(options):
         if options.restore_with_cpu != options.cpu_type:
             CPUClass = TmpClass
             TmpClass, test_mem_mode = getCPUClass(options.restore_with_cpu)
-    elif options.fast_forward:
+    elif (
+        options.fast_forward or options.sample_period or options.fork_simpoints
+    ):
         CPUClass = TmpClass
         CPUISA = ObjectList.cpu_list.get_isa(options.cpu_type)
         TmpClass = getCPUClass(
@@ -315,7 +324,9 @@ def parseSimpointAnalysisFile(options, testsys):
         weight_filename,
         interval_length,
         warmup_length,
-    ) = options.take_simpoint_checkpoints.split(",", 3)
+    ) = (options.take_simpoint_checkpoints or options.fork_simpoints).split(
+        ",", 3
+    )
     print("simpoint analysis file:", simpoint_filename)
     print("simpoint weight file:", weight_filename)
     print("interval length:", interval_length)
@@ -376,7 +387,8 @@ def parseSimpointAnalysisFile(options, testsys):
         simpoint_start_insts.append(starting_inst_count)
 
     print("Total # of simpoints:", len(simpoints))
-    testsys.cpu[0].simpoint_start_insts = simpoint_start_insts
+    if options.take_simpoint_checkpoints:
+        testsys.cpu[0].simpoint_start_insts = simpoint_start_insts
 
     return (simpoints, interval_length)
 
@@ -452,6 +464,144 @@ def restoreSimpointCheckpoint():
     sys.exit(exit_event.getCode())
 
 
+def forkSimpoints(
+    options, testsys, switch_cpu_list, simpoints, interval_length, maxtick
+):
+    """Fast forwards once through the SimPoints, and forks a child at the
+    start of each of them which switches to the detailed CPUs and
+    simulates its warmup and interval. The children share the memory of
+    the simulator with the parent until they write to it, so the
+    checkpoint is only loaded once. Each child writes its stats in its
+    own output directory, and the parent merges them by weight."""
+    jobs = options.fork_jobs or os.cpu_count()
+    running = set()
+    children = []
+    failed = 0
+
+    def reap():
+        nonlocal failed
+        pid, status = os.wait()
+        running.discard(pid)
+        if status != 0:
+            failed += 1
+
+    position = 0
+    exit_cause = "all SimPoints forked"
+    for index, simpoint in enumerate(simpoints):
+        interval, weight, starting_inst_count, actual_warmup_length = simpoint
+        if starting_inst_count > position:
+            exit_event = simulateInsts(
+                testsys.cpu[0], starting_inst_count - position, maxtick
+            )
+            if exit_event is not None:
+                exit_cause = exit_event.getCause()
+                break
+            position = starting_inst_count
+
+        while len(running) >= jobs:
+            reap()
+
+        outdir = joinpath(m5.options.outdir, "simpoint_%02d" % index)
+        pid = m5.fork(outdir.replace("%", "%%"))
+        if pid == 0:
+            simulateSimpoint(
+                testsys,
+                switch_cpu_list,
+                actual_warmup_length,
+                interval_length,
+                maxtick,
+            )
+        print(
+            "Forked SimPoint #%d (pid %d) @ inst %d, weight %f"
+            % (index, pid, starting_inst_count, weight)
+        )
+        running.add(pid)
+        children.append((index, weight, outdir))
+
+    while running:
+        reap()
+
+    mergeSimpointStats(children)
+    print("Exiting @ tick %i because %s" % (m5.curTick(), exit_cause))
+    print("%d SimPoints simulated, %d failed" % (len(children), failed))
+    sys.exit(1 if failed else 0)
+
+
+def simulateSimpoint(
+    testsys, switch_cpu_list, warmup_length, interval_length, maxtick
+):
+    """Simulates a SimPoint in a forked child, and exits."""
+    m5.switchCpus(testsys, switch_cpu_list)
+    detailed_cpus = [pair[1] for pair in switch_cpu_list]
+
+    exit_event = None
+    if warmup_length:
+        exit_event = simulateInsts(detailed_cpus[0], warmup_length, maxtick)
+    if exit_event is not None:
+        print("SimPoint warmup ended because %s" % exit_event.getCause())
+        sys.exit(1)
+
+    m5.stats.reset()
+    insts = sum(cpu.totalInsts() for cpu in detailed_cpus)
+    cycles = detailed_cpus[0].getCurrentCycle()
+    exit_event = simulateInsts(detailed_cpus[0], interval_length, maxtick)
+    if exit_event is not None:
+        print("SimPoint ended early because %s" % exit_event.getCause())
+    result = {
+        "insts": sum(cpu.totalInsts() for cpu in detailed_cpus) - insts,
+        "cycles": detailed_cpus[0].getCurrentCycle() - cycles,
+    }
+    with open(joinpath(m5.options.outdir, "simpoint.json"), "w") as f:
+        json.dump(result, f)
+
+    # The stats are dumped on exit
+    sys.exit(0)
+
+
+def mergeSimpointStats(children):
+    """Averages the stats of the SimPoint children by weight, and writes
+    them with the weighted CPI to simpoints.txt in the output directory."""
+    total = {}
+    weights = {}
+    cpi = 0.0
+    cpi_weight = 0.0
+    for index, weight, outdir in children:
+        try:
+            with open(joinpath(outdir, "simpoint.json")) as f:
+                result = json.load(f)
+        except OSError:
+            warn("No results for SimPoint #%d in %s", index, outdir)
+            continue
+        if result["insts"]:
+            cpi += weight * result["cycles"] / result["insts"]
+            cpi_weight += weight
+
+        # Use the last dump, which is the one done on exit
+        values = {}
+        with open(joinpath(outdir, "stats.txt")) as f:
+            for line in f:
+                if line.startswith("---------- Begin"):
+                    values = {}
+                fields = line.split()
+                if len(fields) < 2:
+                    continue
+                try:
+                    values[fields[0]] = float(fields[1])
+                except ValueError:
+                    pass
+        for name, value in values.items():
+            total[name] = total.get(name, 0.0) + weight * value
+            weights[name] = weights.get(name, 0.0) + weight
+
+    with open(joinpath(m5.options.outdir, "simpoints.txt"), "w") as f:
+        if cpi_weight:
+            cpi /= cpi_weight
+            print("Weighted CPI: %.4f (IPC %.4f)" % (cpi, 1 / cpi))
+            f.write("weightedCPI %f\n" % cpi)
+        for name, value in total.items():
+            f.write("%s %f\n" % (name, value / weights[name]))
+
+
 def repeatSwitch(testsys, repeat_switch_cpu_list, maxtick, switch_freq):
     print("starting switch loop")
     while True:
@@ -472,6 +622,114 @@ def repeatSwitch(testsys, repeat_switch_cpu_list, maxtick, switch_freq):
             exit_event = m5.simulate(maxtick - m5.curTick())
             return exit_event
 
+
+def simulateInsts(cpu, insts, maxtick):
+    """Simulates until the first thread of cpu commits insts instructions,
+    returning None if it did, or the event that ended the simulation."""
+    cause = "sample instruction count reached"
+    cpu.scheduleInstStop(0, insts, cause)
+    exit_event = m5.simulate(maxtick - m5.curTick())
+    if exit_event.getCause() == cause:
+        return None
+    return exit_event
+
+
+def sampledSimulation(options, testsys, switch_cpu_list, maxtick):
+    """Runs a SMARTS-style sampled simulation.
+
+    Every sampling unit of --sample-period instructions is fast forwarded
+    by the functional CPUs, which keep warming up the caches and, if
+    shared, the branch predictors. The last instructions of the unit are
+    simulated by the detailed CPUs: --sample-warmup instructions to warm
+    up their pipelines, then --sample-length measured instructions whose
+    stats are dumped. The instruction counts are those of the first CPU.
+    """
+    functional_cpus = [pair[0] for pair in switch_cpu_list]
+    detailed_cpus = [pair[1] for pair in switch_cpu_list]
+    back_cpu_list = [(new, old) for old, new in switch_cpu_list]
+    gap = options.sample_period - options.sample_warmup - options.sample_length
+
+    exit_event = None
+    if options.fast_forward:
+        exit_event = simulateInsts(
+            functional_cpus[0], int(options.fast_forward), maxtick
+        )
+
+    cpis = []
+    while exit_event is None and (
+        options.sample_max is None or len(cpis) < options.sample_max
+    ):
+        exit_event = simulateInsts(functional_cpus[0], gap, maxtick)
+        if exit_event is not None:
+            break
+
+        m5.switchCpus(testsys, switch_cpu_list)
+        if options.sample_warmup:
+            exit_event = simulateInsts(
+                detailed_cpus[0], options.sample_warmup, maxtick
+            )
+
+        if exit_event is None:
+            m5.stats.reset()
+            insts = sum(cpu.totalInsts() for cpu in detailed_cpus)
+            cycles = detailed_cpus[0].getCurrentCycle()
+            exit_event = simulateInsts(
+                detailed_cpus[0], options.sample_length, maxtick
+            )
+            if exit_event is None:
+                m5.stats.dump()
+                insts = sum(cpu.totalInsts() for cpu in detailed_cpus) - insts
+                cycles = detailed_cpus[0].getCurrentCycle() - cycles
+                cpis.append(cycles / insts)
+                print(
+                    "Sample %d @ tick %d: IPC %.4f"
+                    % (len(cpis), m5.curTick(), 1 / cpis[-1])
+                )
+
+        if exit_event is None:
+            m5.switchCpus(testsys, back_cpu_list)
+
+    if exit_event is None:
+        exit_event = m5.simulate(maxtick - m5.curTick())
+
+    total_insts = sum(cpu.totalInsts() for cpu in functional_cpus)
+    total_insts += sum(cpu.totalInsts() for cpu in detailed_cpus)
+    reportSamples(options, cpis, total_insts)
+    return exit_event
+
+
+def reportSamples(options, cpis, total_insts):
+    """Prints the CPI estimated from the samples with its confidence
+    interval, and writes it to sampling.txt in the output directory."""
+    lines = ["Samples: %d" % len(cpis)]
+    if cpis:
+        cpi = mean(cpis)
+        lines.append("Mean CPI: %.4f (IPC %.4f)" % (cpi, 1 / cpi))
+    if len(cpis) > 1:
+        # Confidence interval of the mean, and number of samples needed
+        # for a +-3% interval, from the coefficient of variation
+        z = NormalDist().inv_cdf((1 + options.sample_confidence) / 2)
+        cov = stdev(cpis) / cpi
+        error = z * cov / len(cpis) ** 0.5
+        lines.append("CPI coefficient of variation: %.4f" % cov)
+        lines.append(
+            "%.1f%% confidence interval: +-%.2f%%"
+            % (options.sample_confidence * 100, error * 100)
+        )
+        lines.append(
+            "Samples needed for +-3%%: %d" % int((z * cov / 0.03) ** 2 + 1)
+        )
+    if cpis:
+        lines.append("Total instructions: %d" % total_insts)
+        lines.append("Estimated cycles: %d" % int(total_insts * cpi))
+
+    report = "\n".join(lines) + "\n"
+    print(report, end="")
+    if m5.options.outdir:
+        with open(joinpath(m5.options.outdir, "sampling.txt"), "w") as f:
+            f.write(report)
+
+
 def run(options, root, testsys, cpu_class):
     if options.checkpoint_dir:
         cptdir = options.checkpoint_dir
@@ -492,6 +750,36 @@ def run(options, root, testsys, cpu_class):
     if options.repeat_switch and options.take_checkpoints:
         fatal("Can't specify both --repeat-switch and --take-checkpoints")
 
+    if options.sample_period and (
+        options.standard_switch or options.repeat_switch
+    ):
+        fatal("Can't sample with --standard-switch or --repeat-switch")
+
+    if options.sample_period and (
+        options.sample_period <= options.sample_warmup + options.sample_length
+    ):
+        fatal("--sample-period must exceed the sample warmup and length")
+
+    if options.sample_period and not cpu_class:
+        fatal("Sampling needs a --restore-with-cpu other than --cpu-type")
+
+    if options.fork_simpoints and (
+        options.sample_period
+        or options.fast_forward
+        or options.standard_switch
+        or options.repeat_switch
+    ):
+        fatal(
+            "Can't fork SimPoints with --sample-period, --fast-forward, "
+            "--standard-switch or --repeat-switch"
+        )
+
+    if options.fork_simpoints and not cpu_class:
+        fatal(
+            "Forking SimPoints needs a --restore-with-cpu other than "
+            "--cpu-type"
+        )
+
     # Setup global stat filtering.
     stat_root_simobjs = []
     for stat_root_str in options.stats_root:
@@ -522,7 +810,8 @@ def run(options, root, testsys, cpu_class):
         ]
 
         for i in range(np):
-            if options.fast_forward:
+            # Sampled simulations fast forward by themselves
+            if options.fast_forward and not options.sample_period:
                 testsys.cpu[i].max_insts_any_thread = int(options.fast_forward)
             switch_cpus[i].system = testsys
             switch_cpus[i].workload = testsys.cpu[i].workload
@@ -545,6 +834,14 @@ def run(options, root, testsys, cpu_class):
                 switch_cpus[
                     i
                 ].branchPred.indirectBranchPred = IndirectBPClass()
+            if (
+                options.bp_functional_warmup
+                or options.sample_period
+                or options.fork_simpoints
+            ):
+                # The predictor is a child of the switched-in CPU, and
+                # only a reference in the fast-forwarding one
+                testsys.cpu[i].branchPred = switch_cpus[i].branchPred
             switch_cpus[i].createThreads()
 
             cpu_type = ObjectList.cpu_list.get(options.cpu_type)
@@ -721,11 +1018,15 @@ def run(options, root, testsys, cpu_class):
             for i in range(np):
                 testsys.cpu[i].max_insts_any_thread = offset
 
-    if options.take_simpoint_checkpoints != None:
+    if options.take_simpoint_checkpoints != None or options.fork_simpoints:
         simpoints, interval_length = parseSimpointAnalysisFile(
             options, testsys
         )
 
+    # Simulators with listeners can not be forked
+    if options.fork_simpoints:
+        m5.disableAllListeners()
+
     checkpoint_dir = None
     if options.checkpoint_restore:
         cpt_starttick, checkpoint_dir = findCptDir(options, cptdir, testsys)
@@ -797,7 +1098,9 @@ def run(options, root, testsys, cpu_class):
             cpt_starttick,
         )
 
-    if options.standard_switch or cpu_class:
+    if (options.standard_switch or cpu_class) and not (
+        options.sample_period or options.fork_simpoints
+    ):
         if options.standard_switch:
             print(
                 "Switch at instruction count:%s"
@@ -856,6 +1159,17 @@ def run(options, root, testsys, cpu_class):
     elif options.take_simpoint_checkpoints != None:
         takeSimpointCheckpoints(simpoints, interval_length, cptdir)
 
+    # Simulate the SimPoints in forked children
+    elif options.fork_simpoints:
+        forkSimpoints(
+            options,
+            testsys,
+            switch_cpu_list,
+            simpoints,
+            interval_length,
+            maxtick,
+        )
+
     # Restore from SimPoint checkpoints
     elif options.restore_simpoint_checkpoint:
         restoreSimpointCheckpoint()
@@ -867,7 +1181,11 @@ def run(options, root, testsys, cpu_class):
 
         # If checkpoints are being taken, then the checkpoint instruction
         # will occur in the benchmark code it self.
-        if options.repeat_switch and maxtick > options.repeat_switch:
+        if options.sample_period:
+            exit_event = sampledSimulation(
+                options, testsys, switch_cpu_list, maxtick
+            )
+        elif options.repeat_switch and maxtick > options.repeat_switch:
             exit_event = repeatSwitch(
                 testsys, repeat_switch_cpu_list, maxtick, options.repeat_switch
             )
@@ -196,6 +196,8 @@ system = System(
 if numThreads > 1:
     system.multi_thread = True
 
+system.cow_image_segments = args.cow_image_segments
+
 # Create a top-level voltage domain
 system.voltage_domain = VoltageDomain(voltage=args.sys_voltage)
 
@@ -308,5 +310,13 @@ if args.wait_gdb:
 Simulation.setWorkCountOptions(system, args)
 
 root = Root(full_system=False, system=system)
+
+if args.eventq_per_core:
+    if args.ruby or not (args.caches and args.l2cache and args.l3cache):
+        fatal("--eventq-per-core requires the classic 3-level hierarchy")
+    m5.ticks.fixGlobalFrequency()
+    root.sim_quantum = m5.ticks.fromSeconds(
+        m5.util.convert.anyToLatency(args.sim_quantum)
+    )
 print("Running simulation from SE python script...")
 Simulation.run(args, root, system, FutureClass)
\ No newline at end of file
@@ -0,0 +1,133 @@
+import argparse
+import time
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+
+from common import (
+    MemConfig,
+    ObjectList,
+)
+
+# This script measures the host throughput of the memory controller
+# scheduler. A traffic generator saturates a single channel with random
+# requests, so that the read and write queues stay full, and the host
+# time per serviced burst is reported. Run it with large buffers, e.g.
+# --read-buffer-size 256, to see how scheduling scales with the queue
+# depth.
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter
+)
+
+parser.add_argument(
+    "--mem-type",
+    default="DDR4_2400_16x4",
+    choices=ObjectList.mem_list.get_names(),
+    help="type of memory to use",
+)
+
+parser.add_argument(
+    "--mem-ranks",
+    "-r",
+    type=int,
+    default=2,
+    help="Number of ranks of the channel",
+)
+
+parser.add_argument(
+    "--read-buffer-size",
+    type=int,
+    default=256,
+    help="Number of read queue entries",
+)
+
+parser.add_argument(
+    "--write-buffer-size",
+    type=int,
+    default=256,
+    help="Number of write queue entries",
+)
+
+parser.add_argument(
+    "--rd-perc", type=int, default=70, help="Percentage of read commands"
+)
+
+parser.add_argument(
+    "--duration",
+    type=int,
+    default=100000000,
+    help="Simulated ticks of traffic",
+)
+
+args = parser.parse_args()
+
+system = System(membus=IOXBar(width=32))
+system.clk_domain = SrcClockDomain(
+    clock="2.0GHz", voltage_domain=VoltageDomain(voltage="1V")
+)
+
+mem_range = AddrRange("1GB")
+system.mem_ranges = [mem_range]
+
+system.mmap_using_noreserve = True
+
+args.mem_channels = 1
+args.external_memory_system = 0
+args.tlm_memory = 0
+args.elastic_trace_en = 0
+MemConfig.config_mem(args, system)
+
+if not isinstance(system.mem_ctrls[0], m5.objects.MemCtrl):
+    fatal("This script assumes the controller is a MemCtrl subclass")
+if not isinstance(system.mem_ctrls[0].dram, m5.objects.DRAMInterface):
+    fatal("This script assumes the memory is a DRAMInterface subclass")
+
+system.mem_ctrls[0].dram.null = True
+system.mem_ctrls[0].dram.read_buffer_size = args.read_buffer_size
+system.mem_ctrls[0].dram.write_buffer_size = args.write_buffer_size
+
+system.tgen = PyTrafficGen()
+system.tgen.port = system.membus.cpu_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+
+m5.instantiate()
+
+# Issue requests faster than the channel can serve them, so that the
+# queues of the controller are always full
+system.tgen.start(
+    [
+        system.tgen.createRandom(
+            args.duration,
+            0,
+            mem_range.end,
+            64,
+            100,
+            100,
+            args.rd_perc,
+            0,
+        ),
+        system.tgen.createExit(0),
+    ]
+)
+
+host_start = time.time()
+m5.simulate()
+host_seconds = time.time() - host_start
+
+print(
+    "Scheduled %d simulated ticks with %d/%d read/write entries in %.2f "
+    "host seconds, see the controller stats for the serviced bursts"
+    % (
+        args.duration,
+        args.read_buffer_size,
+        args.write_buffer_size,
+        host_seconds,
+    )
+)
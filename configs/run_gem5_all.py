@@ -100,7 +100,7 @@ def add_command_checkpoint(directory, command, options, num_cores = 4):
     tasks.append(task)
     return len(tasks) - 1
 
-def add_command_run_MAA(directory, checkpoint, checkpoint_id, command, options, mode, tile_size = 16384, reconfigurable_RT = False, maa_warmer = False, num_cores = 4, do_prefetch = True, do_reorder = True):
+def add_command_run_MAA(directory, checkpoint, checkpoint_id, command, options, mode, tile_size = 16384, reconfigurable_RT = False, maa_warmer = False, num_cores = 4, do_prefetch = True, do_reorder = True, simpoints = None, simpoint_jobs = 8):
     have_maa = False
     l2_hwp_type = "StridePrefetcher"
     l3_size = "8MB"
@@ -173,6 +173,11 @@ def add_command_run_MAA(directory, checkpoint, checkpoint_id, command, options,
     COMMAND += f"--options \"{options}\" "
     if checkpoint != None:
         COMMAND += f"-r 1 "
+    # simpoints = "<simpoint file>,<weight file>,<interval>,<warmup>": a
+    # single task forks a child per SimPoint, sharing the restored memory
+    if simpoints != None:
+        COMMAND += f"--fork-simpoints {simpoints} "
+        COMMAND += f"--fork-jobs {simpoint_jobs} "
     COMMAND += f"--prog-interval={program_interval} "
     COMMAND += f"2>&1 "
     COMMAND += "| awk '{ print strftime(), $0; fflush() }' "
@@ -0,0 +1,79 @@
+import argparse
+import os
+import subprocess
+import time
+
+# Runs the same se.py configuration serially and with --eventq-per-core,
+# checks that repeated parallel runs produce identical statistics and
+# reports the host speedup of the parallel runs.
+
+GEM5_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--gem5", type=str, default=f"{GEM5_DIR}/build/X86/gem5.opt")
+parser.add_argument("--outdir", type=str, default="m5out_parallel_check")
+parser.add_argument("--cmd", type=str, required=True)
+parser.add_argument("--options", type=str, default="")
+parser.add_argument("-n", "--num-cpus", type=int, default=4)
+parser.add_argument("--cpu-type", type=str, default="X86O3CPU")
+parser.add_argument("--sim-quantum", type=str, default="10ns")
+parser.add_argument("--runs", type=int, default=2, help="Number of parallel runs compared for determinism")
+parser.add_argument("--maa", action="store_true")
+parser.add_argument("--extra", type=str, default="", help="Extra arguments passed to se.py")
+args = parser.parse_args()
+
+# Stats that depend on the host rather than on the simulated system
+HOST_STATS = ("host", "hostSeconds", "hostTickRate", "hostMemory", "hostInstRate", "hostOpRate")
+
+def run(directory, parallel):
+    command = [args.gem5, f"--outdir={directory}", f"{GEM5_DIR}/configs/deprecated/example/se.py"]
+    command += ["--cpu-type", args.cpu_type, "-n", str(args.num_cpus)]
+    command += ["--caches", "--l2cache", "--l3cache"]
+    if args.maa:
+        command += ["--maa"]
+    if parallel:
+        command += ["--eventq-per-core", "--sim-quantum", args.sim_quantum]
+    command += ["--cmd", args.cmd, "--options", args.options]
+    command += args.extra.split()
+    os.makedirs(directory, exist_ok=True)
+    start = time.time()
+    with open(f"{directory}/logs_run.txt", "w") as log:
+        subprocess.run(command, stdout=log, stderr=subprocess.STDOUT, check=True)
+    return time.time() - start
+
+def read_stats(directory):
+    stats = {}
+    with open(f"{directory}/stats.txt") as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) < 2 or fields[0].startswith("-"):
+                continue
+            name = fields[0]
+            if name.split(".")[-1] in HOST_STATS:
+                continue
+            stats[name] = fields[1]
+    return stats
+
+serial_time = run(f"{args.outdir}/serial", False)
+print(f"serial: {serial_time:.1f}s")
+
+parallel_times = []
+parallel_stats = []
+for run_id in range(args.runs):
+    directory = f"{args.outdir}/parallel_{run_id}"
+    parallel_times.append(run(directory, True))
+    parallel_stats.append(read_stats(directory))
+    print(f"parallel[{run_id}]: {parallel_times[-1]:.1f}s")
+
+deterministic = True
+for run_id in range(1, args.runs):
+    mismatches = [name for name in parallel_stats[0] if parallel_stats[run_id].get(name) != parallel_stats[0][name]]
+    if len(mismatches) != 0:
+        deterministic = False
+        print(f"parallel[{run_id}] differs from parallel[0] in {len(mismatches)} stats, e.g.:")
+        for name in mismatches[:10]:
+            print(f"  {name}: {parallel_stats[0][name]} vs. {parallel_stats[run_id].get(name)}")
+
+print(f"deterministic: {deterministic}")
+print(f"speedup: {serial_time / min(parallel_times):.2f}x with {args.num_cpus + 1} event queues")
+exit(0 if deterministic else 1)
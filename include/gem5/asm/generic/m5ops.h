@@ -77,6 +77,7 @@
 #define M5OP_WORKLOAD         0x70
 #define M5OP_ADD_MEM_REGION   0x80
 #define M5OP_CLEAR_MEM_REGION 0x81
+#define M5OP_FLUSH_RANGE      0x82
 
 #define M5OP_FOREACH                                 \
     M5OP(m5_arm, M5OP_ARM)                           \
@@ -106,7 +107,8 @@
     M5OP(m5_dist_toggle_sync, M5OP_DIST_TOGGLE_SYNC) \
     M5OP(m5_workload, M5OP_WORKLOAD)                 \
     M5OP(m5_add_mem_region, M5OP_ADD_MEM_REGION)     \
-    M5OP(m5_clear_mem_region, M5OP_CLEAR_MEM_REGION)
+    M5OP(m5_clear_mem_region, M5OP_CLEAR_MEM_REGION) \
+    M5OP(m5_flush_range, M5OP_FLUSH_RANGE)
 
 #define M5OP_MERGE_TOKENS_I(a, b) a##b
 #define M5OP_MERGE_TOKENS(a, b)   M5OP_MERGE_TOKENS_I(a, b)
@@ -66,6 +66,7 @@ void m5_work_begin(uint64_t workid, uint64_t threadid);
 void m5_work_end(uint64_t workid, uint64_t threadid);
 void m5_add_mem_region(void *start, void *end, int8_t id);
 void m5_clear_mem_region();
+void m5_flush_range(void *start, void *end, uint64_t invalidate);
 
 /*
  * Send a very generic poke to the workload so it can do something. It's up to
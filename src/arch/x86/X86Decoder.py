@@ -30,3 +30,10 @@ class X86Decoder(InstDecoder):
     type = "X86Decoder"
     cxx_class = "gem5::X86ISA::Decoder"
     cxx_header = "arch/x86/decoder.hh"
+
+    shareDecodeCache = Param.Bool(
+        False,
+        "Share the instructions decoded at each address with the decoders "
+        "of the other contexts of the event queue, checking them against "
+        "the fetched bytes",
+    )
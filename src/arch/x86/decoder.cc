@@ -66,7 +66,7 @@ Decoder::doResetState()
     emi.modRM = 0;
     emi.sib = 0;
 
-    if (instBytes->si) {
+    if (instBytes->si || (sharedPages && lookupShared())) {
         return FromCacheState;
     } else {
         instBytes->chunks.clear();
@@ -672,7 +672,42 @@ Decoder::doImmediateState()
 }
 
 Decoder::InstBytes Decoder::dummy;
-Decoder::InstCacheMap Decoder::instCacheMap;
+std::unordered_map<uint32_t, Decoder::InstCacheMap> Decoder::instCacheMaps;
+std::unordered_map<uint32_t, Decoder::SharedCacheMap>
+    Decoder::sharedCacheMaps;
+std::mutex Decoder::cacheMapsMutex;
+
+Decoder::DecoderStats::DecoderStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(sharedHits, statistics::units::Count::get(),
+               "Number of instructions missing in the local decode cache "
+               "found in the one shared between the decoders"),
+      ADD_STAT(sharedMisses, statistics::units::Count::get(),
+               "Number of instructions missing in both the local and the "
+               "shared decode caches")
+{
+}
+
+bool
+Decoder::lookupShared()
+{
+    auto iter = sharedPages->find(origPC);
+    if (iter == sharedPages->end()) {
+        ++stats.sharedMisses;
+        return false;
+    }
+
+    DPRINTF(Decoder, "Found %#x in the shared decode cache.\n", origPC);
+    ++stats.sharedHits;
+    *instBytes = iter->second;
+    return true;
+}
+
+void
+Decoder::insertShared()
+{
+    (*sharedPages)[origPC] = *instBytes;
+}
 
 StaticInstPtr
 Decoder::decode(ExtMachInst mach_inst, Addr addr)
@@ -703,8 +738,10 @@ Decoder::decode(PCStateBase &next_pc)
     updateNPC(next_pc.as<PCState>());
 
     StaticInstPtr &si = instBytes->si;
-    if (si)
+    if (si) {
+        si->size(basePC + offset - origPC);
         return si;
+    }
 
     // We didn't match in the AddrMap, but we still populated an entry. Fix
     // up its byte masks.
@@ -734,7 +771,10 @@ Decoder::decode(PCStateBase &next_pc)
         start = 0;
     }
 
-    return decode(emi, origPC);
+    si = decode(emi, origPC);
+    if (sharedPages)
+        insertShared();
+    return si;
 }
 
 StaticInstPtr
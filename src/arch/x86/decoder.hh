@@ -30,6 +30,7 @@
 #define __ARCH_X86_DECODER_HH__
 
 #include <cassert>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -39,6 +40,7 @@
 #include "arch/x86/types.hh"
 #include "base/bitfield.hh"
 #include "base/logging.hh"
+#include "base/statistics.hh"
 #include "base/trace.hh"
 #include "base/types.hh"
 #include "cpu/decode_cache.hh"
@@ -244,7 +246,44 @@ class Decoder : public InstDecoder
     decode_cache::InstMap<ExtMachInst> *instMap = nullptr;
     typedef std::unordered_map<
             CacheKey, decode_cache::InstMap<ExtMachInst> *> InstCacheMap;
-    static InstCacheMap instCacheMap;
+
+    /// Instructions decoded by any of the decoders of the event queue,
+    /// looked up when the local decodePages miss. The fetched bytes are
+    /// checked against them as for local entries, so decoders running
+    /// different address spaces can share them safely.
+    typedef std::unordered_map<Addr, InstBytes> SharedPages;
+    SharedPages *sharedPages = nullptr;
+    typedef std::unordered_map<CacheKey, SharedPages> SharedCacheMap;
+
+    /// The InstMaps and the shared caches of each event queue. StaticInsts
+    /// are reference counted and sized without synchronization, so they
+    /// are only shared by the decoders of a same event queue.
+    static std::unordered_map<uint32_t, InstCacheMap> instCacheMaps;
+    static std::unordered_map<uint32_t, SharedCacheMap> sharedCacheMaps;
+
+    /// Guards the maps of instCacheMaps and sharedCacheMaps, which the
+    /// decoders of several event queues may add to at once.
+    static std::mutex cacheMapsMutex;
+
+    /// Event queue of the decoder, which selects its caches.
+    const uint32_t eventqIndex;
+
+    /// Look up the instruction at origPC in the shared cache.
+    bool lookupShared();
+
+    /// Publish the instruction just decoded to the shared cache.
+    void insertShared();
+
+    struct DecoderStats : public statistics::Group
+    {
+        DecoderStats(statistics::Group *parent);
+
+        statistics::Scalar sharedHits;
+        statistics::Scalar sharedMisses;
+    } stats;
+
+    /// Share decoded instructions with the other decoders.
+    const bool shareDecodeCache;
 
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
@@ -256,7 +295,9 @@ class Decoder : public InstDecoder
     void process();
 
   public:
-    Decoder(const X86DecoderParams &p) : InstDecoder(p, &fetchChunk)
+    Decoder(const X86DecoderParams &p) :
+        InstDecoder(p, &fetchChunk), eventqIndex(p.eventq_index),
+        stats(this), shareDecodeCache(p.shareDecodeCache)
     {
         emi.reset();
         emi.mode.cpl = cpl;
@@ -287,6 +328,9 @@ class Decoder : public InstDecoder
             addrCacheMap[m5Reg] = decodePages;
         }
 
+        std::lock_guard<std::mutex> lock(cacheMapsMutex);
+
+        InstCacheMap &instCacheMap = instCacheMaps[eventqIndex];
         InstCacheMap::iterator imIter = instCacheMap.find(m5Reg);
         if (imIter != instCacheMap.end()) {
             instMap = imIter->second;
@@ -294,6 +338,9 @@ class Decoder : public InstDecoder
             instMap = new decode_cache::InstMap<ExtMachInst>;
             instCacheMap[m5Reg] = instMap;
         }
+
+        if (shareDecodeCache)
+            sharedPages = &sharedCacheMaps[eventqIndex][m5Reg];
     }
 
     void
@@ -47,12 +47,20 @@ class ImageFileData
     std::string _filename;
     uint8_t *_data;
     size_t _len;
+    int _fd;
 
   public:
     const std::string &filename() const { return _filename; }
     uint8_t const *data() const { return _data; }
     size_t len() const { return _len; }
 
+    /**
+     * Descriptor of the file the data is mapped from, kept open so that
+     * parts of it can be mapped again, e.g. copy-on-write into the
+     * simulated memory.
+     */
+    int fd() const { return _fd; }
+
     ImageFileData(const std::string &f_name);
     virtual ~ImageFileData();
 };
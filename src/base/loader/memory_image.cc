@@ -39,7 +39,11 @@ bool
 MemoryImage::writeSegment(const Segment &seg, const PortProxy &proxy) const
 {
     if (seg.size != 0) {
-        if (seg.data) {
+        if (seg.data && seg.ifd) {
+            // Let the proxy map the segment from its file if it can
+            proxy.writeFileBlob(seg.base, seg.data, seg.size, seg.ifd->fd(),
+                                seg.data - seg.ifd->data());
+        } else if (seg.data) {
             proxy.writeBlob(seg.base, seg.data, seg.size);
         } else {
             // no image: must be bss
@@ -43,9 +43,12 @@
 
 #include <cassert>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/types.hh"
+#include "sim/serialize.hh"
 
 namespace gem5
 {
@@ -291,6 +294,16 @@ class GenericSatCounter
      */
     void reset() { counter = initialVal; }
 
+    /**
+     * Set the counter to a value, saturating it at the maximum value.
+     * This is meant for restoring a counter, e.g., from a checkpoint.
+     *
+     * @param value The new value of the counter.
+     *
+     * @ingroup api_sat_counter
+     */
+    void set(T value) { counter = value > maxVal ? maxVal : value; }
+
     /**
      * Calculate saturation percentile of the current counter's value
      * with regard to its maximum possible value.
@@ -340,6 +353,31 @@ typedef GenericSatCounter<uint32_t> SatCounter32;
 typedef GenericSatCounter<uint64_t> SatCounter64;
 /** @} */
 
+template <typename T>
+void
+arrayParamOut(CheckpointOut &cp, const std::string &name,
+              const std::vector<GenericSatCounter<T>> &param)
+{
+    std::vector<T> temp(param.begin(), param.end());
+    arrayParamOut(cp, name, temp);
+}
+
+template <typename T>
+void
+arrayParamIn(CheckpointIn &cp, const std::string &name,
+             std::vector<GenericSatCounter<T>> &param)
+{
+    std::vector<T> temp;
+    arrayParamIn(cp, name, temp);
+
+    fatal_if(temp.size() != param.size(),
+             "Counter table size mismatch on %s (Got %u, expected %u)",
+             name, temp.size(), param.size());
+
+    for (size_t i = 0; i < temp.size(); i++)
+        param[i].set(temp[i]);
+}
+
 } // namespace gem5
 
 #endif // __BASE_SAT_COUNTER_HH__
@@ -527,3 +527,22 @@ TEST(SatCounterTest, Size64)
     counter_64 >>= 1;
     ASSERT_EQ(counter_64, 0);
 }
+
+/** Test that setting a counter saturates it at its maximum value. */
+TEST(SatCounterTest, Set)
+{
+    const unsigned bits = 3;
+    const unsigned max_value = (1 << bits) - 1;
+    SatCounter8 counter(bits, 2);
+
+    counter.set(5);
+    ASSERT_EQ(counter, 5);
+    counter++;
+    ASSERT_EQ(counter, 6);
+    counter.set(max_value + 4);
+    ASSERT_EQ(counter, max_value);
+    counter.set(0);
+    ASSERT_EQ(counter, 0);
+    counter.reset();
+    ASSERT_EQ(counter, 2);
+}
@@ -80,6 +80,7 @@
 #include "base/logging.hh"
 #include "base/stats/group.hh"
 #include "base/stats/info.hh"
+#include "base/stats/level.hh"
 #include "base/stats/output.hh"
 #include "base/stats/storage.hh"
 #include "base/stats/types.hh"
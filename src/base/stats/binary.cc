@@ -0,0 +1,264 @@
+#include "base/stats/binary.hh"
+
+#include <cstring>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+/** Name of element i of a vector, its subname if it has one. */
+std::string
+elementName(const std::vector<std::string> &subnames, size_type i)
+{
+    if (i < subnames.size() && !subnames[i].empty())
+        return subnames[i];
+    return std::to_string(i);
+}
+
+/** Fixed fields of a distribution, in column order. */
+const char *const distFields[] = {
+    "samples", "sum", "squares", "min_value", "max_value",
+    "underflows", "overflows",
+};
+
+constexpr uint32_t numDistFields = sizeof(distFields) / sizeof(distFields[0]);
+
+} // anonymous namespace
+
+Binary::Binary(std::ostream &_stream)
+    : stream(_stream), cursor(0), numColumns(0)
+{
+    stream.write("GEM5STAT", 8);
+    write(version);
+}
+
+void
+Binary::begin()
+{
+    cursor = 0;
+    newColumns.clear();
+    changedIds.clear();
+    changedValues.clear();
+}
+
+void
+Binary::end()
+{
+    if (!newColumns.empty()) {
+        stream.put('S');
+        write(static_cast<uint32_t>(newColumns.size()));
+        for (const auto &[id, name] : newColumns) {
+            write(id);
+            write(static_cast<uint32_t>(name.size()));
+            stream.write(name.data(), name.size());
+        }
+    }
+
+    stream.put('D');
+    write(static_cast<uint64_t>(curTick()));
+    write(static_cast<uint32_t>(changedIds.size()));
+    stream.write(reinterpret_cast<const char *>(changedIds.data()),
+                 changedIds.size() * sizeof(uint32_t));
+    stream.write(reinterpret_cast<const char *>(changedValues.data()),
+                 changedValues.size() * sizeof(double));
+    stream.flush();
+}
+
+bool
+Binary::valid() const
+{
+    return stream.good();
+}
+
+void
+Binary::beginGroup(const char *name)
+{
+    if (path.empty())
+        path.push_back(name);
+    else
+        path.push_back(path.back() + "." + name);
+}
+
+void
+Binary::endGroup()
+{
+    assert(!path.empty());
+    path.pop_back();
+}
+
+template <typename NameFn>
+uint32_t
+Binary::columns(const Info &info, uint32_t size, NameFn names)
+{
+    if (cursor < stats.size() && stats[cursor].info == &info &&
+        stats[cursor].size == size) {
+        return stats[cursor++].first;
+    }
+
+    auto it = statIndex.find(&info);
+    if (it != statIndex.end() && stats[it->second].size == size) {
+        cursor = it->second + 1;
+        return stats[it->second].first;
+    }
+
+    // First time we see this stat (or its size changed), give it a new
+    // set of columns.
+    const std::string name =
+        path.empty() ? info.name : path.back() + "." + info.name;
+    const uint32_t first = numColumns;
+    for (uint32_t i = 0; i < size; ++i) {
+        const std::string suffix = names(i);
+        newColumns.emplace_back(first + i,
+            suffix.empty() ? name : name + "::" + suffix);
+    }
+    numColumns += size;
+
+    statIndex[&info] = stats.size();
+    stats.push_back({&info, first, size});
+    cursor = stats.size();
+    return first;
+}
+
+bool
+Binary::sameBits(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+uint32_t
+Binary::distColumns(const DistData &data)
+{
+    return numDistFields + data.cvec.size();
+}
+
+std::string
+Binary::distColumnName(const DistData &data, uint32_t idx)
+{
+    if (idx < numDistFields)
+        return distFields[idx];
+
+    const Counter low = data.min + (idx - numDistFields) * data.bucket_size;
+    return csprintf("%d-%d", low, low + data.bucket_size - 1);
+}
+
+void
+Binary::recordDist(uint32_t first, const DistData &data)
+{
+    record(first + 0, data.samples);
+    record(first + 1, data.sum);
+    record(first + 2, data.squares);
+    record(first + 3, data.min_val);
+    record(first + 4, data.max_val);
+    record(first + 5, data.underflow);
+    record(first + 6, data.overflow);
+    for (size_t i = 0; i < data.cvec.size(); ++i)
+        record(first + numDistFields + i, data.cvec[i]);
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const uint32_t first = columns(info, 1,
+        [](uint32_t) { return std::string(); });
+    record(first, info.result());
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const VResult &vr = info.result();
+    const uint32_t first = columns(info, vr.size(),
+        [&info](uint32_t i) { return elementName(info.subnames, i); });
+    for (size_t i = 0; i < vr.size(); ++i)
+        record(first + i, vr[i]);
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const DistData &data = info.data;
+    const uint32_t first = columns(info, distColumns(data),
+        [&data](uint32_t i) { return distColumnName(data, i); });
+    recordDist(first, data);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (!info.flags.isSet(display) || info.data.empty())
+        return;
+
+    const uint32_t per_element = distColumns(info.data[0]);
+    const uint32_t first = columns(info, per_element * info.size(),
+        [&info, per_element](uint32_t i) {
+            return elementName(info.subnames, i / per_element) + "::" +
+                distColumnName(info.data[i / per_element], i % per_element);
+        });
+    for (size_type i = 0; i < info.size(); ++i)
+        recordDist(first + i * per_element, info.data[i]);
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const uint32_t first = columns(info, info.x * info.y,
+        [&info](uint32_t i) {
+            return elementName(info.subnames, i / info.y) + "." +
+                elementName(info.y_subnames, i % info.y);
+        });
+    for (size_t i = 0; i < info.cvec.size(); ++i)
+        record(first + i, info.cvec[i]);
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    visit((const VectorInfo &)info);
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    warn_once("Binary stat files don't support sparse histograms.\n");
+}
+
+Output *
+initBinary(const std::string &filename)
+{
+    static std::unordered_map<std::string, Binary *> outputs;
+
+    auto it = outputs.find(filename);
+    if (it != outputs.end())
+        return it->second;
+
+    OutputStream *os = simout.create(filename, true, true);
+    Binary *binary = new Binary(*os->stream());
+    outputs[filename] = binary;
+    return binary;
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,148 @@
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Append-only, columnar binary stats output.
+ *
+ * Every stat element (a scalar, one entry of a vector, one field of a
+ * distribution) is a column identified by a 32-bit id. The file starts
+ * with a header and is followed by a sequence of records:
+ *
+ *   header:  "GEM5STAT" magic, uint32 version
+ *   schema:  'S', uint32 count, count x (uint32 id, uint32 len, name)
+ *   dump:    'D', uint64 tick, uint32 count, count x uint32 id,
+ *            count x double value
+ *
+ * A schema record is written before the first dump that uses new columns.
+ * A dump record only holds the columns whose value changed since the
+ * previous dump (all of them for the first dump), so periodic dumps of
+ * large configurations only pay for what actually moved. All integers and
+ * doubles are stored in host (little-endian) byte order. The reader lives
+ * in util/decode_stats_bin.py.
+ */
+class Binary : public Output
+{
+  public:
+    static constexpr uint32_t version = 1;
+
+    Binary(std::ostream &stream);
+
+    Binary() = delete;
+    Binary(const Binary &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /** Columns allocated to a stat, in visit order. */
+    struct StatColumns
+    {
+        const Info *info;
+        uint32_t first;
+        uint32_t size;
+    };
+
+    /**
+     * Get the first column of a stat with the given number of elements,
+     * allocating the columns if the stat has not been seen before. Stats
+     * are visited in the same order on every dump, so the common case is
+     * a match with the cursor and no lookup is needed.
+     *
+     * @param info Stat info structure.
+     * @param size Number of columns of the stat.
+     * @param names Generates the name suffix of each column, only called
+     *        when the columns are allocated.
+     */
+    template <typename NameFn>
+    uint32_t columns(const Info &info, uint32_t size, NameFn names);
+
+    /** Record the value of a column if it changed since the last dump. */
+    void
+    record(uint32_t column, double value)
+    {
+        if (column >= lastValues.size()) {
+            lastValues.resize(column + 1, 0.0);
+            seen.resize(column + 1, false);
+        }
+        // Compare bit patterns so that NaNs do not show up as changes
+        // on every dump.
+        if (seen[column] && sameBits(lastValues[column], value))
+            return;
+        lastValues[column] = value;
+        seen[column] = true;
+        changedIds.push_back(column);
+        changedValues.push_back(value);
+    }
+
+    /** Record the fields and buckets of a distribution. */
+    void recordDist(uint32_t first, const DistData &data);
+
+    /** Name suffixes of the columns of a distribution. */
+    static std::string distColumnName(const DistData &data, uint32_t idx);
+
+    /** Number of columns of a distribution. */
+    static uint32_t distColumns(const DistData &data);
+
+    static bool sameBits(double a, double b);
+
+    template <typename T>
+    void
+    write(const T &value)
+    {
+        stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+  protected:
+    std::ostream &stream;
+
+    /** Dotted path of the current group, only used to name new columns. */
+    std::vector<std::string> path;
+
+    std::vector<StatColumns> stats;
+    std::unordered_map<const Info *, size_t> statIndex;
+    size_t cursor;
+    uint32_t numColumns;
+
+    /** Columns created during this dump, written as a schema record. */
+    std::vector<std::pair<uint32_t, std::string>> newColumns;
+
+    std::vector<double> lastValues;
+    std::vector<bool> seen;
+    std::vector<uint32_t> changedIds;
+    std::vector<double> changedValues;
+};
+
+Output *initBinary(const std::string &filename);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_BINARY_HH__
@@ -0,0 +1,20 @@
+#include "base/stats/level.hh"
+
+#include <algorithm>
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+Level _level = static_cast<Level>(STATS_MAX_LEVEL);
+
+void
+setLevel(Level level)
+{
+    _level = std::min(level, static_cast<Level>(STATS_MAX_LEVEL));
+}
+
+} // namespace statistics
+} // namespace gem5
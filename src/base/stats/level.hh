@@ -0,0 +1,48 @@
+#ifndef __BASE_STATS_LEVEL_HH__
+#define __BASE_STATS_LEVEL_HH__
+
+#include <cstdint>
+
+#include "config/stats_max_level.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Amount of statistics maintained on hot simulation paths.
+ *
+ * Basic covers the aggregate counters most studies need (e.g., cache hits
+ * and misses per command), Full adds the detailed breakdowns (per-region
+ * stats, MSHR and latency accounting). Stat updates guarded by a level
+ * above the runtime level are skipped, and updates guarded by a level
+ * above STATS_MAX_LEVEL are removed at compile time.
+ */
+enum class Level : uint8_t
+{
+    None = 0,
+    Basic = 1,
+    Full = 2,
+};
+
+/** Runtime statistics level, see setLevel(). */
+extern Level _level;
+
+/** Set the runtime statistics level, clamped to STATS_MAX_LEVEL. */
+void setLevel(Level level);
+
+inline Level level() { return _level; }
+
+/** Check if stat updates of the given level have to be performed. */
+inline bool
+atLevel(Level l)
+{
+    return static_cast<int>(l) <= STATS_MAX_LEVEL && l <= _level;
+}
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_LEVEL_HH__
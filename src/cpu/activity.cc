@@ -121,6 +121,16 @@ ActivityRecorder::deactivateStage(const int idx)
     assert(activityCount >= 0);
 }
 
+bool
+ActivityRecorder::communicating()
+{
+    for (int i = 0; i <= longestLatency; ++i) {
+        if (activityBuffer[-i])
+            return true;
+    }
+    return false;
+}
+
 void
 ActivityRecorder::reset()
 {
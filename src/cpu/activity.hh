@@ -90,6 +90,11 @@ class ActivityRecorder
     /** Returns if the CPU should be active. */
     bool active() { return activityCount; }
 
+    /** Returns if any cycle of the time buffer has communication in it,
+     *  whatever the activity of the stages.
+     */
+    bool communicating();
+
     /** Clears the time buffer and the activity count. */
     void reset();
 
@@ -470,6 +470,14 @@ public:
      */
     uint64_t getCurrentInstCount(ThreadID tid);
 
+    /**
+     * Get the current cycle of this CPU. Used by Python to measure the
+     * IPC of sampled intervals.
+     *
+     * @return Current cycle in the clock domain of the CPU
+     */
+    uint64_t getCurrentCycle() const { return curCycle(); }
+
 public:
     /**
      * @{
@@ -84,6 +84,8 @@ Fetch2::Fetch2(const std::string &name,
         params.fetch2InputBufferSize);
     }
 
+    branchPredictor.setISA(params.isa[0]);
+
     /* Per-thread input buffers */
     for (ThreadID tid = 0; tid < params.numThreads; tid++) {
         inputBuffer.push_back(
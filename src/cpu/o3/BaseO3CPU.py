@@ -58,6 +58,10 @@ class CommitPolicy(ScopedEnum):
     vals = ["RoundRobin", "OldestReady"]
 
 
+class MemDepPredictorType(ScopedEnum):
+    vals = ["StoreSet", "StoreDistance", "IdealStoreDistance"]
+
+
 class BaseO3CPU(BaseCPU):
     type = "BaseO3CPU"
     cxx_class = "gem5::o3::CPU"
@@ -76,6 +80,11 @@ class BaseO3CPU(BaseCPU):
         return True
 
     activity = Param.Unsigned(0, "Initial count")
+    idleOnMemoryStall = Param.Bool(
+        False,
+        "Stop ticking while every stage is stalled behind a load at the "
+        "head of the ROB, until the load completes or an interrupt arrives",
+    )
 
     cacheStorePorts = Param.Unsigned(
         200, "Cache Ports. Constrains stores only."
@@ -147,13 +156,23 @@ class BaseO3CPU(BaseCPU):
         "Should dependency violations be checked for "
         "loads & stores or just stores",
     )
+    memDepPredictor = Param.MemDepPredictorType(
+        "StoreSet", "Memory dependence predictor"
+    )
     store_set_clear_period = Param.Unsigned(
         250000,
         "Number of load/store insts before the dep predictor "
-        "should be invalidated",
+        "should be invalidated, 0 to never invalidate it",
     )
     LFSTSize = Param.Unsigned(1024, "Last fetched store table size")
     SSITSize = Param.Unsigned(1024, "Store set ID table size")
+    SDTSize = Param.Unsigned(1024, "Store distance table size")
+    maxStoreDistance = Param.Unsigned(
+        63, "Largest store distance the store distance predictor predicts"
+    )
+    storeDistanceConfidenceBits = Param.Unsigned(
+        2, "Width of the store distance confidence counters"
+    )
 
     numRobs = Param.Unsigned(1, "Number of Reorder Buffers")
 
@@ -171,6 +190,12 @@ class BaseO3CPU(BaseCPU):
     # most ISAs don't use condition-code regs, so default is 0
     numPhysCCRegs = Param.Unsigned(0, "Number of physical cc registers")
     numIQEntries = Param.Unsigned(64, "Number of instruction queue entries")
+    iqReadyMatrix = Param.Bool(
+        False,
+        "Select ready instructions from age-ordered bit vectors rather "
+        "than from per op class priority queues, issuing the same "
+        "instructions",
+    )
     numROBEntries = Param.Unsigned(192, "Number of reorder buffer entries")
 
     smtNumFetchingThreads = Param.Unsigned(1, "SMT Number of Fetching Threads")
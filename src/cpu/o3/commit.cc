@@ -655,6 +655,36 @@ Commit::tick()
     updateStatus();
 }
 
+bool
+Commit::canSkipStalledCycles()
+{
+    if (interrupt != NoFault || drainPending || drainImminent)
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (commitStatus[tid] != Running || trapSquash[tid] ||
+            tcSquash[tid] || rob->isEmpty(tid) ||
+            rob->readHeadInst(tid)->readyToCommit()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+Commit::skipStalledCycles(Cycles cycles)
+{
+    stats.numCommittedDist.sample(0, cycles);
+    rob->skipStalledCycles(cycles);
+
+    for (ThreadID tid : *activeThreads) {
+        const DynInstPtr &inst = rob->readHeadInst(tid);
+        for (Cycles i(0); i < cycles; ++i)
+            ppCommitStall->notify(inst);
+    }
+}
+
 void
 Commit::handleInterrupt()
 {
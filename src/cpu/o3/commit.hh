@@ -205,6 +205,12 @@ class Commit
     /** Ticks the commit stage, which tries to commit instructions. */
     void tick();
 
+    /** Can the stage go without ticking, stalled in its current state. */
+    bool canSkipStalledCycles();
+
+    /** Account for cycles spent stalled without ticking. */
+    void skipStalledCycles(Cycles cycles);
+
     /** Handles any squashes that are sent from IEW, and adds instructions
      * to the ROB and tries to commit instructions.
      */
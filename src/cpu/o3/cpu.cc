@@ -72,13 +72,18 @@ namespace o3
 CPU::CPU(const BaseO3CPUParams &params)
     : BaseCPU(params),
       mmu(params.mmu),
-      tickEvent([this]{ tick(); }, "O3CPU tick",
+      tickEvent([this]{ tick(); }, name() + ".tickEvent",
                 false, Event::CPU_Tick_Pri),
       threadExitEvent([this]{ exitThreads(); }, "O3CPU exit threads",
                 false, Event::CPU_Exit_Pri),
 #ifndef NDEBUG
       instcount(0),
 #endif
+      dynInstPool(this,
+                  DynInst::bufferSize(DynInst::pooledSrcRegs,
+                                      DynInst::pooledDestRegs),
+                  params.numROBEntries +
+                  params.fetchQueueSize * params.numThreads),
       removeInstsThisCycle(false),
       fetch(this, params),
       decode(this, params),
@@ -110,6 +115,7 @@ CPU::CPU(const BaseO3CPUParams &params)
       activityRec(name(), NumStages,
                   params.backComSize + params.forwardComSize,
                   params.activity),
+      idleOnMemoryStall(params.idleOnMemoryStall),
 
       globalSeqNum(1),
       system(params.system),
@@ -328,7 +334,10 @@ CPU::CPUStats::CPUStats(CPU *cpu)
                "to idling"),
       ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
                "Total number of cycles that CPU has spent quiesced or waiting "
-               "for an interrupt")
+               "for an interrupt"),
+      ADD_STAT(memStallCycles, statistics::units::Cycle::get(),
+               "Number of cycles that the CPU has spent unscheduled while "
+               "all its stages were stalled on a load")
 {
     // Register any of the O3CPU's stats here.
     timesIdled
@@ -339,6 +348,9 @@ CPU::CPUStats::CPUStats(CPU *cpu)
 
     quiesceCycles
         .prereq(quiesceCycles);
+
+    memStallCycles
+        .prereq(memStallCycles);
 }
 
 void
@@ -348,6 +360,9 @@ CPU::tick()
     assert(!switchedOut());
     assert(drainState() != DrainState::Drained);
 
+    // The tick may have been scheduled by other means than wakeCPU()
+    stalledOnMemory = false;
+
     ++baseStats.numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
@@ -387,6 +402,10 @@ CPU::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             cpuStats.timesIdled++;
+        } else if (idleOnMemoryStall && canSkipStalledCycles()) {
+            DPRINTF(O3CPU, "Stalled on memory!\n");
+            lastRunningCycle = curCycle();
+            stalledOnMemory = true;
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -1297,7 +1316,8 @@ CPU::wakeDependents(const DynInstPtr &inst)
 void
 CPU::wakeCPU()
 {
-    if (activityRec.active() || tickEvent.scheduled()) {
+    if ((activityRec.active() && !stalledOnMemory) ||
+        tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
         return;
     }
@@ -1308,16 +1328,66 @@ CPU::wakeCPU()
     // @todo: This is an oddity that is only here to match the stats
     if (cycles > 1) {
         --cycles;
-        cpuStats.idleCycles += cycles;
+        if (stalledOnMemory) {
+            // Account for the cycles the stages would have spent stalled
+            fetch.skipStalledCycles(cycles);
+            decode.skipStalledCycles(cycles);
+            rename.skipStalledCycles(cycles);
+            iew.skipStalledCycles(cycles);
+            commit.skipStalledCycles(cycles);
+            cpuStats.memStallCycles += cycles;
+        } else {
+            cpuStats.idleCycles += cycles;
+        }
         baseStats.numCycles += cycles;
     }
 
+    stalledOnMemory = false;
     schedule(tickEvent, clockEdge());
 }
 
+bool
+CPU::canSkipStalledCycles()
+{
+    // Only a single thread is handled, so that the fetch and commit
+    // policies that pick between threads need not be replayed. Any
+    // communication in flight between the stages would also be delayed.
+    if (numThreads != 1 || activeThreads.size() != 1 ||
+        drainState() != DrainState::Running ||
+        activityRec.communicating()) {
+        return false;
+    }
+
+    ThreadID tid = activeThreads.front();
+    if (checkInterrupts(tid) || rob.isEmpty(tid))
+        return false;
+
+    // The oldest instruction must be a load waiting on the memory system,
+    // its writeback wakes the CPU up
+    const DynInstPtr &head = rob.readHeadInst(tid);
+    if (!head->isLoad() || !head->isIssued() || head->isExecuted() ||
+        head->isSquashed()) {
+        return false;
+    }
+
+    LSQ::LSQRequest *request = head->lqIt->request();
+    if (!request || !request->isTranslationComplete() ||
+        !request->isAnyOutstandingRequest()) {
+        return false;
+    }
+
+    return fetch.canSkipStalledCycles() && decode.canSkipStalledCycles() &&
+        rename.canSkipStalledCycles() && iew.canSkipStalledCycles() &&
+        commit.canSkipStalledCycles();
+}
+
 void
 CPU::wakeup(ThreadID tid)
 {
+    // Interrupts are only checked by commit while ticking
+    if (stalledOnMemory)
+        wakeCPU();
+
     if (thread[tid]->status() != gem5::ThreadContext::Suspended)
         return;
 
@@ -54,6 +54,7 @@
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/commit.hh"
 #include "cpu/o3/decode.hh"
+#include "cpu/o3/dyn_inst_pool.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/fetch.hh"
 #include "cpu/o3/free_list.hh"
@@ -376,6 +377,11 @@ public:
     int instcount;
 #endif
 
+    /** Pool recycling the buffers of the dynamic instructions. It is
+     *  declared before every structure that holds instructions, so that
+     *  it outlives them. */
+    DynInstPool dynInstPool;
+
     /** List of all the instructions in flight. */
     std::list<DynInstPtr> instList;
 
@@ -478,6 +484,12 @@ private:
      */
     ActivityRecorder activityRec;
 
+    /** Stop ticking while all the stages are stalled on memory. */
+    const bool idleOnMemoryStall;
+
+    /** Is the CPU unscheduled while stalled on memory. */
+    bool stalledOnMemory = false;
+
 public:
     /** Records that there was time buffer activity this cycle. */
     void activityThisCycle() { activityRec.activity(); }
@@ -497,6 +509,13 @@ public:
     /** Wakes the CPU, rescheduling the CPU if it's not already active. */
     void wakeCPU();
 
+    /**
+     * Can the CPU stop ticking until the load at the head of the ROB
+     * completes. Every stage must be stalled in a state that ticking
+     * would not change, so that the cycles can be accounted for on wakeup.
+     */
+    bool canSkipStalledCycles();
+
     virtual void wakeup(ThreadID tid) override;
 
     /** Gets a free thread id. Use if thread ids change across system. */
@@ -573,6 +592,9 @@ public:
         /** Stat for total number of cycles the CPU spends descheduled due to a
          * quiesce operation or waiting for an interrupt. */
         statistics::Scalar quiesceCycles;
+        /** Stat for total number of cycles the CPU spends descheduled
+         * while all its stages are stalled on a load. */
+        statistics::Scalar memStallCycles;
     } cpuStats;
 
 public:
@@ -483,6 +483,22 @@ Decode::readStallSignals(ThreadID tid)
     }
 }
 
+bool
+Decode::canSkipStalledCycles()
+{
+    for (ThreadID tid : *activeThreads) {
+        if (decodeStatus[tid] != Blocked || !checkStall(tid))
+            return false;
+    }
+    return true;
+}
+
+void
+Decode::skipStalledCycles(Cycles cycles)
+{
+    stats.blockedCycles += activeThreads->size() * cycles;
+}
+
 bool
 Decode::checkSignalsAndUpdate(ThreadID tid)
 {
@@ -136,6 +136,12 @@ class Decode
      */
     void tick();
 
+    /** Can the stage go without ticking, stalled in its current state. */
+    bool canSkipStalledCycles();
+
+    /** Account for cycles spent stalled without ticking. */
+    void skipStalledCycles(Cycles cycles);
+
     /** Determines what to do based on decode's current status.
      * @param status_change decode() sets this variable if there was a status
      * change (ie switching from from blocking to unblocking).
@@ -100,18 +100,68 @@ DynInst::DynInst(const Arrays &arrays, const StaticInstPtr &_staticInst,
                  const StaticInstPtr &_macroop)
     : DynInst(arrays, _staticInst, _macroop, 0, nullptr) {}
 
+namespace
+{
+
+/** Where the arrays go in the buffer of a DynInst of count bytes. */
+struct ArraysLayout
+{
+    uintptr_t flatDestIdx;
+    uintptr_t destIdx;
+    uintptr_t prevDestIdx;
+    uintptr_t srcIdx;
+    uintptr_t readySrcIdx;
+    size_t totalSize;
+
+    ArraysLayout(size_t count, size_t num_srcs, size_t num_dests)
+    {
+        uintptr_t inst = 0;
+        size_t inst_size = count;
+
+        flatDestIdx = roundUp(inst + inst_size, alignof(RegId));
+        size_t flat_dest_idx_size = sizeof(RegId) * num_dests;
+
+        destIdx = roundUp(flatDestIdx + flat_dest_idx_size,
+                          alignof(PhysRegIdPtr));
+        size_t dest_idx_size = sizeof(PhysRegIdPtr) * num_dests;
+
+        prevDestIdx = roundUp(destIdx + dest_idx_size,
+                              alignof(PhysRegIdPtr));
+        size_t prev_dest_idx_size = sizeof(PhysRegIdPtr) * num_dests;
+
+        srcIdx = roundUp(prevDestIdx + prev_dest_idx_size,
+                         alignof(PhysRegIdPtr));
+        size_t src_idx_size = sizeof(PhysRegIdPtr) * num_srcs;
+
+        readySrcIdx = roundUp(srcIdx + src_idx_size, alignof(uint8_t));
+        size_t ready_src_idx_size = sizeof(uint8_t) * ((num_srcs + 7) / 8);
+
+        // Figure out how much space we need in total.
+        totalSize = readySrcIdx + ready_src_idx_size;
+    }
+};
+
+} // anonymous namespace
+
+size_t
+DynInst::bufferSize(size_t num_srcs, size_t num_dests)
+{
+    return ArraysLayout(sizeof(DynInst), num_srcs, num_dests).totalSize;
+}
+
 /*
- * This custom "new" operator uses the default "new" operator to allocate space
- * for a DynInst, but also pads out the number of bytes to make room for some
- * extra structures the DynInst needs. We save time and improve performance by
- * only going to the heap once to get space for all these structures.
+ * This custom "new" operator gets space for a DynInst from the CPU DynInst
+ * pool, or from the heap if there is no pool, but also pads out the number
+ * of bytes to make room for some extra structures the DynInst needs. We save
+ * time and improve performance by only going to the allocator once to get
+ * space for all these structures.
  *
  * When a DynInst is allocated with new, the compiler will call this "new"
  * operator with "count" set to the number of bytes it needs to store the
- * DynInst. We ultimately call into the default new operator to get those
- * bytes, but before we do, we pad out "count" so that there will be extra
- * space for some structures the DynInst needs. We take into account both the
- * absolute size of these structures, and also what alignment they need.
+ * DynInst. Before we get those bytes, we pad out "count" so that there will
+ * be extra space for some structures the DynInst needs. We take into account
+ * both the absolute size of these structures, and also what alignment they
+ * need.
  *
  * Once we've gotten a buffer large enough to hold the DynInst itself and these
  * extra structures, we construct the extra bits using placement new. This
@@ -134,41 +184,18 @@ DynInst::operator new(size_t count, Arrays &arrays) {
     const auto num_srcs = arrays.numSrcs;
 
     // Figure out where everything will go.
-    uintptr_t inst = 0;
-    size_t inst_size = count;
-
-    uintptr_t flat_dest_idx = roundUp(inst + inst_size, alignof(RegId));
-    size_t flat_dest_idx_size = sizeof(*arrays.flatDestIdx) * num_dests;
-
-    uintptr_t dest_idx =
-        roundUp(flat_dest_idx + flat_dest_idx_size, alignof(PhysRegIdPtr));
-    size_t dest_idx_size = sizeof(*arrays.destIdx) * num_dests;
-
-    uintptr_t prev_dest_idx =
-        roundUp(dest_idx + dest_idx_size, alignof(PhysRegIdPtr));
-    size_t prev_dest_idx_size = sizeof(*arrays.prevDestIdx) * num_dests;
-
-    uintptr_t src_idx =
-        roundUp(prev_dest_idx + prev_dest_idx_size, alignof(PhysRegIdPtr));
-    size_t src_idx_size = sizeof(*arrays.srcIdx) * num_srcs;
-
-    uintptr_t ready_src_idx =
-        roundUp(src_idx + src_idx_size, alignof(uint8_t));
-    size_t ready_src_idx_size =
-        sizeof(*arrays.readySrcIdx) * ((num_srcs + 7) / 8);
-
-    // Figure out how much space we need in total.
-    size_t total_size = ready_src_idx + ready_src_idx_size;
+    const ArraysLayout layout(count, num_srcs, num_dests);
 
     // Actually allocate it.
-    uint8_t *buf = (uint8_t *)::operator new(total_size);
+    uint8_t *buf = (uint8_t *)DynInstPool::allocate(arrays.pool,
+                                                    layout.totalSize);
 
     // Fill in "arrays" with pointers to all the arrays.
-    arrays.flatDestIdx = (RegId *)(buf + flat_dest_idx);
-    arrays.destIdx = (PhysRegIdPtr *)(buf + dest_idx);
-    arrays.prevDestIdx = (PhysRegIdPtr *)(buf + prev_dest_idx);
-    arrays.srcIdx = (PhysRegIdPtr *)(buf + src_idx);
-    arrays.readySrcIdx = (uint8_t *)(buf + ready_src_idx);
+    arrays.flatDestIdx = (RegId *)(buf + layout.flatDestIdx);
+    arrays.destIdx = (PhysRegIdPtr *)(buf + layout.destIdx);
+    arrays.prevDestIdx = (PhysRegIdPtr *)(buf + layout.prevDestIdx);
+    arrays.srcIdx = (PhysRegIdPtr *)(buf + layout.srcIdx);
+    arrays.readySrcIdx = (uint8_t *)(buf + layout.readySrcIdx);
 
     // Initialize all the extra components.
     new (arrays.flatDestIdx) RegId[num_dests];
@@ -180,11 +207,12 @@ DynInst::operator new(size_t count, Arrays &arrays) {
     return buf;
 }
 
-// Because of the custom "new" operator that allocates more bytes than the
-// size of the DynInst object, AddressSanitizer throw new-delete-type-mismatch.
-// Adding a custom delete function is enough to shut down this false positive
+// The buffer goes back to the pool it came from. This also keeps
+// AddressSanitizer from throwing new-delete-type-mismatch, because of the
+// custom "new" operator that allocates more bytes than the size of the
+// DynInst object.
 void DynInst::operator delete(void *ptr) {
-    ::operator delete(ptr);
+    DynInstPool::release(ptr);
 }
 
 DynInst::~DynInst() {
@@ -56,6 +56,7 @@
 #include "cpu/inst_res.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/cpu.hh"
+#include "cpu/o3/dyn_inst_pool.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/lsq_unit.hh"
 #include "cpu/op_class.hh"
@@ -83,6 +84,9 @@ public:
         size_t numSrcs;
         size_t numDests;
 
+        /** Pool to allocate the instruction from, the heap if null. */
+        DynInstPool *pool = nullptr;
+
         RegId *flatDestIdx;
         PhysRegIdPtr *destIdx;
         PhysRegIdPtr *prevDestIdx;
@@ -93,6 +97,14 @@ public:
     static void *operator new(size_t count, Arrays &arrays);
     static void operator delete(void *ptr);
 
+    /** Register counts of the largest instructions that fit in a slot of
+     *  the CPU DynInst pool. */
+    static constexpr size_t pooledSrcRegs = 16;
+    static constexpr size_t pooledDestRegs = 16;
+
+    /** Number of bytes operator new allocates for an instruction. */
+    static size_t bufferSize(size_t num_srcs, size_t num_dests);
+
     /** BaseDynInst constructor given a binary instruction. */
     DynInst(const Arrays &arrays, const StaticInstPtr &staticInst,
             const StaticInstPtr &macroop, InstSeqNum seq_num, CPU *cpu);
@@ -330,6 +342,9 @@ public:
     /** Pointer to the data for the memory access. */
     uint8_t *memData = nullptr;
 
+    /** Index in the instruction list of its thread in the IQ. */
+    ssize_t iqIdx = -1;
+
     /** Load queue index. */
     ssize_t lqIdx = -1;
     typename LSQUnit::LQIterator lqIt;
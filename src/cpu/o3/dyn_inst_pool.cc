@@ -0,0 +1,104 @@
+#include "cpu/o3/dyn_inst_pool.hh"
+
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+DynInstPool::DynInstPool(statistics::Group *parent, size_t slot_size,
+                         size_t slab_slots)
+    : statistics::Group(parent, "dynInstPool"),
+      slotSize(headerSize + (slot_size + alignof(std::max_align_t) - 1) /
+               alignof(std::max_align_t) * alignof(std::max_align_t)),
+      slabSlots(slab_slots),
+      ADD_STAT(slabAllocations, statistics::units::Count::get(),
+               "Number of instructions allocated from the slabs"),
+      ADD_STAT(heapAllocations, statistics::units::Count::get(),
+               "Number of instructions too large for a slot, allocated "
+               "from the heap"),
+      ADD_STAT(slabsAllocated, statistics::units::Count::get(),
+               "Number of slabs allocated"),
+      ADD_STAT(occupancy, statistics::units::Count::get(),
+               "Average number of slots holding an instruction"),
+      ADD_STAT(peakOccupancy, statistics::units::Count::get(),
+               "Largest number of slots holding an instruction")
+{
+    fatal_if(slabSlots == 0, "The DynInst pool needs slots in its slabs");
+    grow();
+}
+
+DynInstPool::~DynInstPool()
+{
+    for (void *slab : slabs)
+        ::operator delete(slab);
+}
+
+void
+DynInstPool::grow()
+{
+    uint8_t *slab = static_cast<uint8_t *>(
+        ::operator new(slotSize * slabSlots));
+    slabs.push_back(slab);
+    ++slabsAllocated;
+
+    // Push the slots so that they are handed out in address order
+    for (size_t i = slabSlots; i-- > 0;) {
+        void *slot = slab + i * slotSize;
+        *static_cast<void **>(slot) = freeList;
+        freeList = slot;
+    }
+}
+
+void *
+DynInstPool::allocate(DynInstPool *pool, size_t size)
+{
+    void *slot;
+    if (pool && headerSize + size <= pool->slotSize) {
+        if (!pool->freeList)
+            pool->grow();
+        slot = pool->freeList;
+        pool->freeList = *static_cast<void **>(slot);
+
+        ++pool->slabAllocations;
+        ++pool->inUse;
+        pool->occupancy = pool->inUse;
+        if (pool->inUse > pool->peakOccupancy.value())
+            pool->peakOccupancy = pool->inUse;
+    } else {
+        if (pool)
+            ++pool->heapAllocations;
+        slot = ::operator new(headerSize + size);
+        pool = nullptr;
+    }
+
+    static_cast<Header *>(slot)->pool = pool;
+    return static_cast<uint8_t *>(slot) + headerSize;
+}
+
+void
+DynInstPool::release(void *ptr)
+{
+    void *slot = static_cast<uint8_t *>(ptr) - headerSize;
+    DynInstPool *pool = static_cast<Header *>(slot)->pool;
+    if (!pool) {
+        ::operator delete(slot);
+        return;
+    }
+
+    *static_cast<void **>(slot) = pool->freeList;
+    pool->freeList = slot;
+
+    assert(pool->inUse > 0);
+    --pool->inUse;
+    pool->occupancy = pool->inUse;
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,88 @@
+#ifndef __CPU_O3_DYN_INST_POOL_HH__
+#define __CPU_O3_DYN_INST_POOL_HH__
+
+#include <cstddef>
+#include <vector>
+
+#include "base/statistics.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Recycles the buffers of the dynamic instructions of a CPU. Fetch builds
+ * an instruction for every fetched micro-op, wrong-path ones included, so
+ * instead of going to the heap every time the buffers are carved out of
+ * large slabs and put on a free list when their instruction dies.
+ *
+ * Every buffer is preceded by a header pointing back to its pool, so that
+ * it can be released without knowing which CPU it belongs to. Buffers
+ * larger than a slot, or requested without a pool, are taken from the heap
+ * and have a null header.
+ */
+class DynInstPool : public statistics::Group
+{
+  public:
+    /**
+     * @param parent The CPU the pool belongs to.
+     * @param slot_size Largest buffer served from the slabs.
+     * @param slab_slots Number of slots of every slab, the first one is
+     *        allocated right away.
+     */
+    DynInstPool(statistics::Group *parent, size_t slot_size,
+                size_t slab_slots);
+    ~DynInstPool();
+
+    DynInstPool(const DynInstPool &) = delete;
+    DynInstPool &operator=(const DynInstPool &) = delete;
+
+    /**
+     * Get a buffer of size bytes, aligned for any fundamental type.
+     *
+     * @param pool The pool to take it from, or nullptr for the heap.
+     */
+    static void *allocate(DynInstPool *pool, size_t size);
+
+    /** Give back a buffer returned by allocate. */
+    static void release(void *ptr);
+
+  private:
+    struct Header
+    {
+        DynInstPool *pool;
+    };
+
+    /** Size of the header, which keeps the buffer after it aligned. */
+    static constexpr size_t headerSize =
+        (sizeof(Header) + alignof(std::max_align_t) - 1) /
+        alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    /** Add a slab of slabSlots slots to the free list. */
+    void grow();
+
+    /** Size of a slot, header included. */
+    const size_t slotSize;
+    const size_t slabSlots;
+
+    std::vector<void *> slabs;
+
+    /** Free slots, linked through their first word. */
+    void *freeList = nullptr;
+
+    /** Number of slots holding an instruction. */
+    size_t inUse = 0;
+
+    statistics::Scalar slabAllocations;
+    statistics::Scalar heapAllocations;
+    statistics::Scalar slabsAllocated;
+    statistics::Average occupancy;
+    statistics::Scalar peakOccupancy;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_DYN_INST_POOL_HH__
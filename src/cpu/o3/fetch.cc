@@ -133,6 +133,7 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
     }
 
     branchPred = params.branchPred;
+    branchPred->setISA(params.isa[0]);
 
     for (ThreadID tid = 0; tid < numThreads; tid++) {
         decoder[tid] = params.decoder[tid];
@@ -913,6 +914,58 @@ Fetch::tick()
     numInst = 0;
 }
 
+bool
+Fetch::canSkipStalledCycles()
+{
+    if (finishTranslationEvent.scheduled() || interruptPending)
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        // Nothing may be sent to decode
+        if (stalls[tid].drain ||
+            (!stalls[tid].decode && !fetchQueue[tid].empty())) {
+            return false;
+        }
+
+        if (fetchStatus[tid] == IcacheWaitResponse)
+            continue;
+
+        // A running thread must have a full queue, and must neither need
+        // nor prefetch another fetch buffer
+        if (fetchStatus[tid] != Running ||
+            fetchQueue[tid].size() < fetchQueueSize) {
+            return false;
+        }
+
+        Addr fetch_addr = (pc[tid]->instAddr() + fetchOffset[tid]) &
+            decoder[tid]->pcMask();
+        if (!macroop[tid] && !(fetchBufferValid[tid] &&
+                fetchBufferAlignPC(fetch_addr) == fetchBufferPC[tid])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+Fetch::skipStalledCycles(Cycles cycles)
+{
+    for (ThreadID tid : *activeThreads) {
+        if (fetchStatus[tid] == IcacheWaitResponse)
+            cpu->fetchStats[tid]->icacheStallCycles += cycles;
+        else
+            fetchStats.cycles += cycles;
+    }
+
+    fetchStats.nisnDist.sample(0, cycles);
+
+    // Keep the random number stream as if tick() had picked the thread to
+    // send to decode every cycle
+    for (Cycles i(0); i < cycles; ++i)
+        random_mt.random<uint8_t>(0, activeThreads->size() - 1);
+}
+
 bool
 Fetch::checkSignalsAndUpdate(ThreadID tid)
 {
@@ -1026,6 +1079,7 @@ Fetch::buildInst(ThreadID tid, StaticInstPtr staticInst,
     DynInst::Arrays arrays;
     arrays.numSrcs = staticInst->numSrcRegs();
     arrays.numDests = staticInst->numDestRegs();
+    arrays.pool = &cpu->dynInstPool;
 
     // Create a new DynInst from the instruction fetched.
     DynInstPtr instruction = new (arrays) DynInst(
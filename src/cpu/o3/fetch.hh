@@ -336,6 +336,12 @@ class Fetch
      */
     void tick();
 
+    /** Can the stage go without ticking, stalled in its current state. */
+    bool canSkipStalledCycles();
+
+    /** Account for cycles spent stalled without ticking. */
+    void skipStalledCycles(Cycles cycles);
+
     /** Checks all input signals and updates the status as necessary.
      *  @return: Returns if the status has changed due to input signals.
      */
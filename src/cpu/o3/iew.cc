@@ -1438,6 +1438,37 @@ void IEW::tick() {
     }
 }
 
+bool IEW::canSkipStalledCycles() {
+    if (exeStatus != Idle || updateLSQNextCycle || ldstQueue.willWB() ||
+        !instQueue.canSkipStalledCycles()) {
+        return false;
+    }
+
+    for (ThreadID tid : *activeThreads) {
+        if (dispatchStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if ((dispatchStatus[tid] != Running &&
+                    dispatchStatus[tid] != Idle) ||
+                   !insts[tid].empty() || checkStall(tid)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void IEW::skipStalledCycles(Cycles cycles) {
+    for (ThreadID tid : *activeThreads) {
+        if (dispatchStatus[tid] == Blocked)
+            iewStats.blockCycles += cycles;
+    }
+
+    // updateStatus() reads the IQ every cycle
+    instQueue.iqIOStats.intInstQueueReads += cycles;
+    instQueue.skipStalledCycles(cycles);
+}
+
 void IEW::updateExeInstStats(const DynInstPtr &inst) {
     ThreadID tid = inst->threadNumber;
 
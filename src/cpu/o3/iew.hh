@@ -286,6 +286,12 @@ public:
      */
     void tick();
 
+    /** Can the stage go without ticking, stalled in its current state. */
+    bool canSkipStalledCycles();
+
+    /** Account for cycles spent stalled without ticking. */
+    void skipStalledCycles(Cycles cycles);
+
 private:
     /** Updates execution stats based on the instruction. */
     void updateExeInstStats(const DynInstPtr &inst);
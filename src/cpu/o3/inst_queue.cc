@@ -89,6 +89,11 @@ InstructionQueue::InstructionQueue(CPU *cpu_ptr, IEW *iew_ptr,
     : cpu(cpu_ptr),
       iewStage(iew_ptr),
       fuPool(params.fuPool),
+      instList(MaxThreads, CircularQueue<DynInstPtr>(
+                  params.numROBEntries +
+                  params.commitToIEWDelay * params.commitWidth)),
+      useReadyMatrix(params.iqReadyMatrix),
+      readyMatrix(instList[0].capacity()),
       iqPolicy(params.smtIQPolicy),
       numThreads(params.numThreads),
       numEntries(params.numIQEntries),
@@ -396,7 +401,11 @@ InstructionQueue::resetState()
     //Initialize thread IQ counts
     for (ThreadID tid = 0; tid < MaxThreads; tid++) {
         count[tid] = 0;
-        instList[tid].clear();
+        while (!instList[tid].empty()) {
+            instList[tid].back() = nullptr;
+            instList[tid].pop_back();
+        }
+        instList[tid].flush();
     }
 
     // Initialize the number of free IQ entries.
@@ -421,6 +430,7 @@ InstructionQueue::resetState()
         queueOnList[i] = false;
         readyIt[i] = listOrder.end();
     }
+    readyMatrix.reset();
     nonSpecInsts.clear();
     listOrder.clear();
     deferredMemInsts.clear();
@@ -546,7 +556,7 @@ InstructionQueue::isFull(ThreadID tid)
 bool
 InstructionQueue::hasReadyInsts()
 {
-    if (!listOrder.empty()) {
+    if (!listOrder.empty() || readyMatrix.any()) {
         return true;
     }
 
@@ -559,6 +569,20 @@ InstructionQueue::hasReadyInsts()
     return false;
 }
 
+bool
+InstructionQueue::canSkipStalledCycles()
+{
+    return !hasReadyInsts() && instsToExecute.empty() &&
+        wbOutstanding == 0 && deferredMemInsts.empty() &&
+        blockedMemInsts.empty() && retryMemInsts.empty();
+}
+
+void
+InstructionQueue::skipStalledCycles(Cycles cycles)
+{
+    iqStats.numIssuedDist.sample(0, cycles);
+}
+
 void
 InstructionQueue::insert(const DynInstPtr &new_inst)
 {
@@ -577,7 +601,7 @@ InstructionQueue::insert(const DynInstPtr &new_inst)
 
     assert(freeEntries != 0);
 
-    instList[new_inst->threadNumber].push_back(new_inst);
+    pushInst(new_inst);
 
     --freeEntries;
 
@@ -604,6 +628,33 @@ InstructionQueue::insert(const DynInstPtr &new_inst)
     assert(freeEntries == (numEntries - countInsts()));
 }
 
+void
+InstructionQueue::pushInst(const DynInstPtr &new_inst)
+{
+    auto &insts = instList[new_inst->threadNumber];
+    panic_if(insts.full(), "[tid:%i] IQ instruction list overflow, %d "
+             "instructions are dispatched and not yet committed",
+             new_inst->threadNumber, insts.size());
+    insts.push_back(new_inst);
+    new_inst->iqIdx = insts.tail();
+}
+
+void
+InstructionQueue::setReady(const DynInstPtr &ready_inst)
+{
+    ThreadID tid = ready_inst->threadNumber;
+    ssize_t idx = ready_inst->iqIdx;
+
+    // Memory instructions can be replayed after they were squashed out of
+    // the IQ, and their slot may hold a younger instruction by now.
+    if (!instList[tid].isValidIdx(idx) || instList[tid][idx] != ready_inst) {
+        ++iqStats.squashedInstsIssued;
+        return;
+    }
+
+    readyMatrix.setReady(tid, idx, ready_inst->opClass());
+}
+
 void
 InstructionQueue::insertNonSpec(const DynInstPtr &new_inst)
 {
@@ -627,7 +678,7 @@ InstructionQueue::insertNonSpec(const DynInstPtr &new_inst)
 
     assert(freeEntries != 0);
 
-    instList[new_inst->threadNumber].push_back(new_inst);
+    pushInst(new_inst);
 
     --freeEntries;
 
@@ -775,6 +826,10 @@ InstructionQueue::scheduleReadyInsts()
     // This will avoid trying to schedule a certain op class if there are no
     // FUs that handle it.
     int total_issued = 0;
+    if (useReadyMatrix)
+        total_issued = scheduleFromMatrix(i2e_info);
+
+    // The age order list stays empty when the ready matrix is used
     ListOrderIt order_it = listOrder.begin();
     ListOrderIt order_end_it = listOrder.end();
 
@@ -812,60 +867,7 @@ InstructionQueue::scheduleReadyInsts()
             continue;
         }
 
-        int idx = FUPool::NoCapableFU;
-        Cycles op_latency = Cycles(1);
-        ThreadID tid = issuing_inst->threadNumber;
-
-        if (op_class != No_OpClass) {
-            idx = fuPool->getUnit(op_class);
-            if (issuing_inst->isFloating()) {
-                iqIOStats.fpAluAccesses++;
-            } else if (issuing_inst->isVector()) {
-                iqIOStats.vecAluAccesses++;
-            } else {
-                iqIOStats.intAluAccesses++;
-            }
-            if (idx > FUPool::NoFreeFU) {
-                op_latency = fuPool->getOpLatency(op_class);
-            }
-        }
-
-        // If we have an instruction that doesn't require a FU, or a
-        // valid FU, then schedule for execution.
-        if (idx != FUPool::NoFreeFU) {
-            if (op_latency == Cycles(1)) {
-                i2e_info->size++;
-                instsToExecute.push_back(issuing_inst);
-
-                // Add the FU onto the list of FU's to be freed next
-                // cycle if we used one.
-                if (idx >= 0)
-                    fuPool->freeUnitNextCycle(idx);
-            } else {
-                bool pipelined = fuPool->isPipelined(op_class);
-                // Generate completion event for the FU
-                ++wbOutstanding;
-                FUCompletion *execution = new FUCompletion(issuing_inst,
-                                                           idx, this);
-
-                cpu->schedule(execution,
-                              cpu->clockEdge(Cycles(op_latency - 1)));
-
-                if (!pipelined) {
-                    // If FU isn't pipelined, then it must be freed
-                    // upon the execution completing.
-                    execution->setFreeFU();
-                } else {
-                    // Add the FU onto the list of FU's to be freed next cycle.
-                    fuPool->freeUnitNextCycle(idx);
-                }
-            }
-
-            DPRINTF(IQ, "Thread %i: Issuing instruction PC %s "
-                    "[sn:%llu]\n",
-                    tid, issuing_inst->pcState(),
-                    issuing_inst->seqNum);
-
+        if (issueInst(issuing_inst, op_class, i2e_info)) {
             readyInsts[op_class].pop();
 
             if (!readyInsts[op_class].empty()) {
@@ -875,31 +877,10 @@ InstructionQueue::scheduleReadyInsts()
                 queueOnList[op_class] = false;
             }
 
-            issuing_inst->setIssued();
             ++total_issued;
 
-#if TRACING_ON
-            issuing_inst->issueTick = curTick() - issuing_inst->fetchTick;
-#endif
-
-            if (issuing_inst->firstIssue == -1)
-                issuing_inst->firstIssue = curTick();
-
-            if (!issuing_inst->isMemRef()) {
-                // Memory instructions can not be freed from the IQ until they
-                // complete.
-                ++freeEntries;
-                count[tid]--;
-                issuing_inst->clearInIQ();
-            } else {
-                memDepUnit[tid].issue(issuing_inst);
-            }
-
             listOrder.erase(order_it++);
-            iqStats.statIssuedInstType[tid][op_class]++;
         } else {
-            iqStats.statFuBusy[op_class]++;
-            iqStats.fuBusy[tid]++;
             ++order_it;
         }
     }
@@ -918,6 +899,148 @@ InstructionQueue::scheduleReadyInsts()
     }
 }
 
+int
+InstructionQueue::scheduleFromMatrix(IssueStruct *i2e_info)
+{
+    // Visit the ready instructions of all the threads oldest first, as the
+    // age order list does. Once the units of an op class are all busy its
+    // instructions wait for the next cycle.
+    int total_issued = 0;
+    readyMatrix.startSelect();
+
+    while (total_issued < totalWidth) {
+        ThreadID tid = InvalidThreadID;
+        ssize_t idx = -1;
+
+        for (ThreadID thread = 0; thread < numThreads; ++thread) {
+            ssize_t oldest = readyMatrix.oldestCandidate(
+                thread, instList[thread].head());
+            if (oldest < 0)
+                continue;
+            if (idx < 0 || instList[thread][oldest]->seqNum <
+                           instList[tid][idx]->seqNum) {
+                tid = thread;
+                idx = oldest;
+            }
+        }
+
+        if (idx < 0)
+            break;
+
+        DynInstPtr issuing_inst = instList[tid][idx];
+        OpClass op_class = issuing_inst->opClass();
+
+        if (issuing_inst->isFloating()) {
+            iqIOStats.fpInstQueueReads++;
+        } else if (issuing_inst->isVector()) {
+            iqIOStats.vecInstQueueReads++;
+        } else {
+            iqIOStats.intInstQueueReads++;
+        }
+
+        if (issuing_inst->isSquashed()) {
+            readyMatrix.clearReady(tid, idx, op_class);
+            ++iqStats.squashedInstsIssued;
+            continue;
+        }
+
+        if (issueInst(issuing_inst, op_class, i2e_info)) {
+            readyMatrix.clearReady(tid, idx, op_class);
+            ++total_issued;
+        } else {
+            readyMatrix.blockOpClass(op_class);
+        }
+    }
+
+    return total_issued;
+}
+
+bool
+InstructionQueue::issueInst(const DynInstPtr &issuing_inst, OpClass op_class,
+                            IssueStruct *i2e_info)
+{
+    int idx = FUPool::NoCapableFU;
+    Cycles op_latency = Cycles(1);
+    ThreadID tid = issuing_inst->threadNumber;
+
+    if (op_class != No_OpClass) {
+        idx = fuPool->getUnit(op_class);
+        if (issuing_inst->isFloating()) {
+            iqIOStats.fpAluAccesses++;
+        } else if (issuing_inst->isVector()) {
+            iqIOStats.vecAluAccesses++;
+        } else {
+            iqIOStats.intAluAccesses++;
+        }
+        if (idx > FUPool::NoFreeFU) {
+            op_latency = fuPool->getOpLatency(op_class);
+        }
+    }
+
+    if (idx == FUPool::NoFreeFU) {
+        iqStats.statFuBusy[op_class]++;
+        iqStats.fuBusy[tid]++;
+        return false;
+    }
+
+    // We have an instruction that doesn't require a FU, or a valid FU, so
+    // schedule it for execution.
+    if (op_latency == Cycles(1)) {
+        i2e_info->size++;
+        instsToExecute.push_back(issuing_inst);
+
+        // Add the FU onto the list of FU's to be freed next
+        // cycle if we used one.
+        if (idx >= 0)
+            fuPool->freeUnitNextCycle(idx);
+    } else {
+        bool pipelined = fuPool->isPipelined(op_class);
+        // Generate completion event for the FU
+        ++wbOutstanding;
+        FUCompletion *execution = new FUCompletion(issuing_inst,
+                                                   idx, this);
+
+        cpu->schedule(execution,
+                      cpu->clockEdge(Cycles(op_latency - 1)));
+
+        if (!pipelined) {
+            // If FU isn't pipelined, then it must be freed
+            // upon the execution completing.
+            execution->setFreeFU();
+        } else {
+            // Add the FU onto the list of FU's to be freed next cycle.
+            fuPool->freeUnitNextCycle(idx);
+        }
+    }
+
+    DPRINTF(IQ, "Thread %i: Issuing instruction PC %s "
+            "[sn:%llu]\n",
+            tid, issuing_inst->pcState(),
+            issuing_inst->seqNum);
+
+    issuing_inst->setIssued();
+
+#if TRACING_ON
+    issuing_inst->issueTick = curTick() - issuing_inst->fetchTick;
+#endif
+
+    if (issuing_inst->firstIssue == -1)
+        issuing_inst->firstIssue = curTick();
+
+    if (!issuing_inst->isMemRef()) {
+        // Memory instructions can not be freed from the IQ until they
+        // complete.
+        ++freeEntries;
+        count[tid]--;
+        issuing_inst->clearInIQ();
+    } else {
+        memDepUnit[tid].issue(issuing_inst);
+    }
+
+    iqStats.statIssuedInstType[tid][op_class]++;
+    return true;
+}
+
 void
 InstructionQueue::scheduleNonSpec(const InstSeqNum &inst)
 {
@@ -951,11 +1074,10 @@ InstructionQueue::commit(const InstSeqNum &inst, ThreadID tid)
     DPRINTF(IQ, "[tid:%i] Committing instructions older than [sn:%llu]\n",
             tid,inst);
 
-    ListIt iq_it = instList[tid].begin();
-
-    while (iq_it != instList[tid].end() &&
-           (*iq_it)->seqNum <= inst) {
-        ++iq_it;
+    while (!instList[tid].empty() &&
+           instList[tid].front()->seqNum <= inst) {
+        assert(!readyMatrix.isReady(tid, instList[tid].head()));
+        instList[tid].front() = nullptr;
         instList[tid].pop_front();
     }
 
@@ -1066,6 +1188,14 @@ InstructionQueue::wakeDependents(const DynInstPtr &completed_inst)
 void
 InstructionQueue::addReadyMemInst(const DynInstPtr &ready_inst)
 {
+    if (useReadyMatrix) {
+        DPRINTF(IQ, "Instruction is ready to issue, marking it in the "
+                "ready matrix, PC %s [sn:%llu].\n",
+                ready_inst->pcState(), ready_inst->seqNum);
+        setReady(ready_inst);
+        return;
+    }
+
     OpClass op_class = ready_inst->opClass();
 
     readyInsts[op_class].push(ready_inst);
@@ -1184,19 +1314,26 @@ InstructionQueue::squash(ThreadID tid)
 void
 InstructionQueue::doSquash(ThreadID tid)
 {
-    // Start at the tail.
-    ListIt squash_it = instList[tid].end();
-    --squash_it;
-
     DPRINTF(IQ, "[tid:%i] Squashing until sequence number %i!\n",
             tid, squashedSeqNum[tid]);
 
     // Squash any instructions younger than the squashed sequence number
-    // given.
-    while (squash_it != instList[tid].end() &&
-           (*squash_it)->seqNum > squashedSeqNum[tid]) {
+    // given, starting at the tail. They are younger than every other
+    // instruction of the thread, so the list is simply truncated.
+    while (!instList[tid].empty() &&
+           instList[tid].back()->seqNum > squashedSeqNum[tid]) {
+
+        DynInstPtr squashed_inst = std::move(instList[tid].back());
+        instList[tid].pop_back();
+
+        // Drop it from the ready matrix now, the ready queues instead
+        // discard their squashed instructions when they reach them.
+        if (readyMatrix.isReady(tid, squashed_inst->iqIdx)) {
+            readyMatrix.clearReady(tid, squashed_inst->iqIdx,
+                                   squashed_inst->opClass());
+            ++iqStats.squashedInstsIssued;
+        }
 
-        DynInstPtr squashed_inst = (*squash_it);
         if (squashed_inst->isFloating()) {
             iqIOStats.fpInstQueueWrites++;
         } else if (squashed_inst->isVector()) {
@@ -1209,7 +1346,6 @@ InstructionQueue::doSquash(ThreadID tid)
         // hasn't already been squashed in the IQ.
         if (squashed_inst->threadNumber != tid ||
             squashed_inst->isSquashedInIQ()) {
-            --squash_it;
             continue;
         }
 
@@ -1318,7 +1454,6 @@ InstructionQueue::doSquash(ThreadID tid)
             assert(dependGraph.empty(dest_reg->flatIndex()));
             dependGraph.clearInst(dest_reg->flatIndex());
         }
-        instList[tid].erase(squash_it--);
         ++iqStats.squashedInstsExamined;
     }
 }
@@ -1437,6 +1572,11 @@ InstructionQueue::addIfReady(const DynInstPtr &inst)
                 "the ready list, PC %s opclass:%i [sn:%llu].\n",
                 inst->pcState(), op_class, inst->seqNum);
 
+        if (useReadyMatrix) {
+            setReady(inst);
+            return;
+        }
+
         readyInsts[op_class].push(inst);
 
         // Will need to reorder the list if either a queue is not on the list,
@@ -1505,7 +1645,7 @@ InstructionQueue::dumpInsts()
     for (ThreadID tid = 0; tid < numThreads; ++tid) {
         int num = 0;
         int valid_num = 0;
-        ListIt inst_list_it = instList[tid].begin();
+        auto inst_list_it = instList[tid].begin();
 
         while (inst_list_it != instList[tid].end()) {
             cprintf("Instruction:%i\n", num);
@@ -47,6 +47,7 @@
 #include <queue>
 #include <vector>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -55,6 +56,7 @@
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/limits.hh"
 #include "cpu/o3/mem_dep_unit.hh"
+#include "cpu/o3/ready_matrix.hh"
 #include "cpu/o3/store_set.hh"
 #include "cpu/op_class.hh"
 #include "cpu/timebuf.hh"
@@ -181,6 +183,13 @@ class InstructionQueue
     /** Returns if there are any ready instructions in the IQ. */
     bool hasReadyInsts();
 
+    /** Returns if scheduling would leave the IQ as it is, every cycle
+     *  until an instruction is woken up from outside. */
+    bool canSkipStalledCycles();
+
+    /** Account for cycles in which nothing could be scheduled. */
+    void skipStalledCycles(Cycles cycles);
+
     /** Inserts a new instruction into the IQ. */
     void insert(const DynInstPtr &new_inst);
 
@@ -281,6 +290,26 @@ class InstructionQueue
     /** Does the actual squashing. */
     void doSquash(ThreadID tid);
 
+    /** Appends an instruction to the list of its thread. */
+    void pushInst(const DynInstPtr &new_inst);
+
+    /** Marks a ready instruction in the ready matrix, dropping it if it
+     *  has already been squashed out of the IQ. */
+    void setReady(const DynInstPtr &ready_inst);
+
+    /** Issues the instructions of the ready matrix, oldest first. */
+    int scheduleFromMatrix(IssueStruct *i2e_info);
+
+    /**
+     * Tries to get a functional unit for a ready instruction and sends it
+     * to execute.
+     *
+     * @return Whether the instruction issued, false if all the units of
+     *         its op class are busy.
+     */
+    bool issueInst(const DynInstPtr &issuing_inst, OpClass op_class,
+                   IssueStruct *i2e_info);
+
     /////////////////////////
     // Various pointers
     /////////////////////////
@@ -317,8 +346,11 @@ class InstructionQueue
     // Instruction lists, ready queues, and ordering
     //////////////////////////////////////
 
-    /** List of all the instructions in the IQ (some of which may be issued). */
-    std::list<DynInstPtr> instList[MaxThreads];
+    /** List of all the instructions in the IQ (some of which may be issued),
+     *  from dispatch until they commit or are squashed. Each thread has a
+     *  ring sized for a full ROB plus the instructions the ROB may retire
+     *  before the IQ hears about it, and removed slots are cleared. */
+    std::vector<CircularQueue<DynInstPtr>> instList;
 
     /** List of instructions that are ready to be executed. */
     std::list<DynInstPtr> instsToExecute;
@@ -402,6 +434,13 @@ class InstructionQueue
      */
     void moveToYoungerInst(ListOrderIt age_order_it);
 
+    /** Whether ready instructions are tracked by readyMatrix rather than
+     *  by the ready queues and the age order list. */
+    const bool useReadyMatrix;
+
+    /** Ready instructions, indexed by their position in instList. */
+    ReadyMatrix readyMatrix;
+
     DependencyGraph<DynInstPtr> dependGraph;
 
     //////////////////////////////////////
@@ -0,0 +1,63 @@
+#ifndef __CPU_O3_MEM_DEP_PREDICTOR_HH__
+#define __CPU_O3_MEM_DEP_PREDICTOR_HH__
+
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Interface of the memory dependence predictors used by the MemDepUnit.
+ * Memory instructions are inserted in program order. A predictor names
+ * the older store a memory instruction has to wait for, and learns from
+ * the ordering violations and the false dependences the MemDepUnit
+ * reports.
+ */
+class MemDepPredictor
+{
+  public:
+    virtual ~MemDepPredictor() = default;
+
+    /** Records a memory ordering violation between the younger load
+     *  and the older store. */
+    virtual void violation(Addr store_PC, InstSeqNum store_seq_num,
+                           Addr load_PC, InstSeqNum load_seq_num) = 0;
+
+    /** Records that the load waited for a store it did not depend on. */
+    virtual void falseDependence(Addr load_PC) {}
+
+    /** Inserts a load into the predictor. */
+    virtual void insertLoad(Addr load_PC, InstSeqNum load_seq_num) {}
+
+    /** Inserts a store into the predictor. */
+    virtual void insertStore(Addr store_PC, InstSeqNum store_seq_num,
+                             ThreadID tid) = 0;
+
+    /** Checks if the instruction with the given PC is dependent upon
+     * any store.  @return Returns the sequence number of the store
+     * instruction this PC is dependent upon.  Returns 0 if none.
+     */
+    virtual InstSeqNum checkInst(Addr PC) = 0;
+
+    /** Records this PC/sequence number as issued. */
+    virtual void issued(Addr issued_PC, InstSeqNum issued_seq_num,
+                        bool is_store) {}
+
+    /** Squashes for a specific thread until the given sequence number. */
+    virtual void squash(InstSeqNum squashed_num, ThreadID tid) = 0;
+
+    /** Resets all tables. */
+    virtual void clear() = 0;
+
+    /** Debug function to dump the state of the predictor. */
+    virtual void dump() {}
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_MEM_DEP_PREDICTOR_HH__
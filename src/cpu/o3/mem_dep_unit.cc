@@ -37,7 +37,10 @@
 #include "cpu/o3/dyn_inst.hh"
 #include "cpu/o3/inst_queue.hh"
 #include "cpu/o3/limits.hh"
+#include "cpu/o3/store_distance.hh"
+#include "cpu/o3/store_set.hh"
 #include "debug/MemDepUnit.hh"
+#include "enums/MemDepPredictorType.hh"
 #include "params/BaseO3CPU.hh"
 
 namespace gem5
@@ -46,6 +49,30 @@ namespace gem5
 namespace o3
 {
 
+namespace
+{
+
+std::unique_ptr<MemDepPredictor>
+makeMemDepPredictor(const BaseO3CPUParams &params)
+{
+    switch (params.memDepPredictor) {
+      case MemDepPredictorType::StoreSet:
+        return std::make_unique<StoreSet>(params.store_set_clear_period,
+                                          params.SSITSize, params.LFSTSize);
+      case MemDepPredictorType::StoreDistance:
+        return std::make_unique<StoreDistance>(params.SDTSize,
+            params.maxStoreDistance, params.storeDistanceConfidenceBits);
+      case MemDepPredictorType::IdealStoreDistance:
+        // Unbounded table, and distances up to the store queue size
+        return std::make_unique<StoreDistance>(0, params.SQEntries,
+            params.storeDistanceConfidenceBits);
+      default:
+        panic("Unknown memory dependence predictor");
+    }
+}
+
+} // anonymous namespace
+
 #ifdef GEM5_DEBUG
 int MemDepUnit::MemDepEntry::memdep_count = 0;
 int MemDepUnit::MemDepEntry::memdep_insert = 0;
@@ -56,8 +83,7 @@ MemDepUnit::MemDepUnit() : iqPtr(NULL), stats(nullptr) {}
 
 MemDepUnit::MemDepUnit(const BaseO3CPUParams &params)
     : _name(params.name + ".memdepunit"),
-      depPred(params.store_set_clear_period, params.SSITSize,
-              params.LFSTSize),
+      depPred(makeMemDepPredictor(params)),
       iqPtr(NULL),
       stats(nullptr)
 {
@@ -96,8 +122,7 @@ MemDepUnit::init(const BaseO3CPUParams &params, ThreadID tid, CPU *cpu)
     _name = csprintf("%s.memDep%d", params.name, tid);
     id = tid;
 
-    depPred.init(params.store_set_clear_period, params.SSITSize,
-            params.LFSTSize);
+    depPred = makeMemDepPredictor(params);
 
     std::string stats_group_name = csprintf("MemDepUnit__%i", tid);
     cpu->addStatGroup(stats_group_name.c_str(), &stats);
@@ -112,7 +137,12 @@ MemDepUnit::MemDepUnitStats::MemDepUnitStats(statistics::Group *parent)
       ADD_STAT(conflictingLoads, statistics::units::Count::get(),
                "Number of conflicting loads."),
       ADD_STAT(conflictingStores, statistics::units::Count::get(),
-               "Number of conflicting stores.")
+               "Number of conflicting stores."),
+      ADD_STAT(violations, statistics::units::Count::get(),
+               "Number of memory order violations."),
+      ADD_STAT(falseDependences, statistics::units::Count::get(),
+               "Number of loads that waited for a predicted store they do "
+               "not overlap.")
 {
 }
 
@@ -145,7 +175,7 @@ MemDepUnit::takeOverFrom()
     // Be sure to reset all state.
     loadBarrierSNs.clear();
     storeBarrierSNs.clear();
-    depPred.clear();
+    depPred->clear();
 }
 
 void
@@ -207,6 +237,7 @@ MemDepUnit::insert(const DynInstPtr &inst)
     // Check any barriers and the dependence predictor for any
     // producing memrefs/stores.
     std::vector<InstSeqNum>  producing_stores;
+    InstSeqNum predicted_store = 0;
     if ((inst->isLoad() || inst->isAtomic()) && hasLoadBarrier()) {
         DPRINTF(MemDepUnit, "%d load barriers in flight\n",
                 loadBarrierSNs.size());
@@ -220,9 +251,9 @@ MemDepUnit::insert(const DynInstPtr &inst)
                                 std::begin(storeBarrierSNs),
                                 std::end(storeBarrierSNs));
     } else {
-        InstSeqNum dep = depPred.checkInst(inst->pcState().instAddr());
-        if (dep != 0)
-            producing_stores.push_back(dep);
+        predicted_store = depPred->checkInst(inst->pcState().instAddr());
+        if (predicted_store != 0)
+            producing_stores.push_back(predicted_store);
     }
 
     std::vector<MemDepEntryPtr> store_entries;
@@ -271,6 +302,7 @@ MemDepUnit::insert(const DynInstPtr &inst)
             store_entry->dependInsts.push_back(inst_entry);
 
         inst_entry->memDeps = store_entries.size();
+        inst_entry->predictedStore = predicted_store;
 
         if (inst->isLoad()) {
             ++stats.conflictingLoads;
@@ -286,7 +318,7 @@ MemDepUnit::insert(const DynInstPtr &inst)
         DPRINTF(MemDepUnit, "Inserting store/atomic PC %s [sn:%lli].\n",
                 inst->pcState(), inst->seqNum);
 
-        depPred.insertStore(inst->pcState().instAddr(), inst->seqNum,
+        depPred->insertStore(inst->pcState().instAddr(), inst->seqNum,
                 inst->threadNumber);
 
         ++stats.insertedStores;
@@ -308,7 +340,7 @@ MemDepUnit::insertNonSpec(const DynInstPtr &inst)
         DPRINTF(MemDepUnit, "Inserting store/atomic PC %s [sn:%lli].\n",
                 inst->pcState(), inst->seqNum);
 
-        depPred.insertStore(inst->pcState().instAddr(), inst->seqNum,
+        depPred->insertStore(inst->pcState().instAddr(), inst->seqNum,
                 inst->threadNumber);
 
         ++stats.insertedStores;
@@ -424,9 +456,30 @@ MemDepUnit::completed(const DynInstPtr &inst)
 #endif
 }
 
+void
+MemDepUnit::checkFalseDependence(const DynInstPtr &inst)
+{
+    if (!inst->isLoad() || !inst->effAddrValid())
+        return;
+
+    MemDepEntryPtr &inst_entry = findInHash(inst);
+    if (!inst_entry->predictedStore || !inst_entry->storeSize)
+        return;
+
+    if (inst->effAddr + inst->effSize <= inst_entry->storeAddr ||
+        inst_entry->storeAddr + inst_entry->storeSize <= inst->effAddr) {
+        DPRINTF(MemDepUnit, "Load PC %s [sn:%lli] falsely waited for "
+                "store [sn:%lli].\n", inst->pcState(), inst->seqNum,
+                inst_entry->predictedStore);
+        ++stats.falseDependences;
+        depPred->falseDependence(inst->pcState().instAddr());
+    }
+}
+
 void
 MemDepUnit::completeInst(const DynInstPtr &inst)
 {
+    checkFalseDependence(inst);
     wakeDependents(inst);
     completed(inst);
     InstSeqNum barr_sn = inst->seqNum;
@@ -481,6 +534,12 @@ MemDepUnit::wakeDependents(const DynInstPtr &inst)
         assert(woken_inst->memDeps > 0);
         woken_inst->memDeps -= 1;
 
+        if (woken_inst->predictedStore == inst->seqNum &&
+            inst->effAddrValid()) {
+            woken_inst->storeAddr = inst->effAddr;
+            woken_inst->storeSize = inst->effSize;
+        }
+
         if ((woken_inst->memDeps == 0) &&
             woken_inst->regsReady &&
             !woken_inst->squashed) {
@@ -564,7 +623,7 @@ MemDepUnit::squash(const InstSeqNum &squashed_num, ThreadID tid)
     }
 
     // Tell the dependency predictor to squash as well.
-    depPred.squash(squashed_num, tid);
+    depPred->squash(squashed_num, tid);
 }
 
 void
@@ -575,8 +634,9 @@ MemDepUnit::violation(const DynInstPtr &store_inst,
             " load: %#x, store: %#x\n", violating_load->pcState().instAddr(),
             store_inst->pcState().instAddr());
     // Tell the memory dependence unit of the violation.
-    depPred.violation(store_inst->pcState().instAddr(),
-            violating_load->pcState().instAddr());
+    ++stats.violations;
+    depPred->violation(store_inst->pcState().instAddr(), store_inst->seqNum,
+            violating_load->pcState().instAddr(), violating_load->seqNum);
 }
 
 void
@@ -585,7 +645,8 @@ MemDepUnit::issue(const DynInstPtr &inst)
     DPRINTF(MemDepUnit, "Issuing instruction PC %#x [sn:%lli].\n",
             inst->pcState().instAddr(), inst->seqNum);
 
-    depPred.issued(inst->pcState().instAddr(), inst->seqNum, inst->isStore());
+    depPred->issued(inst->pcState().instAddr(), inst->seqNum,
+                    inst->isStore());
 }
 
 MemDepUnit::MemDepEntryPtr &
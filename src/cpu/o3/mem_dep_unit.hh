@@ -51,7 +51,7 @@
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/limits.hh"
-#include "cpu/o3/store_set.hh"
+#include "cpu/o3/mem_dep_predictor.hh"
 #include "debug/MemDepUnit.hh"
 
 namespace gem5
@@ -209,6 +209,13 @@ class MemDepUnit
         /** If the instruction is squashed. */
         bool squashed = false;
 
+        /** The store the predictor made this instruction wait for, 0 if
+         *  none. */
+        InstSeqNum predictedStore = 0;
+        /** Address range written by that store, set when it completes. */
+        Addr storeAddr = 0;
+        unsigned storeSize = 0;
+
         /** For debugging. */
 #ifdef GEM5_DEBUG
         static int memdep_count;
@@ -223,6 +230,10 @@ class MemDepUnit
     /** Moves an entry to the ready list. */
     void moveToReady(MemDepEntryPtr &ready_inst_entry);
 
+    /** Tells the predictor if a completed load waited for a store it
+     *  does not overlap. */
+    void checkFalseDependence(const DynInstPtr &inst);
+
     typedef std::unordered_map<InstSeqNum, MemDepEntryPtr, SNHash> MemDepHash;
 
     typedef typename MemDepHash::iterator MemDepHashIt;
@@ -241,7 +252,7 @@ class MemDepUnit
      *  this unit what instruction the newly added instruction is dependent
      *  upon.
      */
-    StoreSet depPred;
+    std::unique_ptr<MemDepPredictor> depPred;
 
     /** Sequence numbers of outstanding load barriers. */
     std::unordered_set<InstSeqNum> loadBarrierSNs;
@@ -276,6 +287,11 @@ class MemDepUnit
         /** Stat for number of conflicting stores that had to wait for a
          *  store. */
         statistics::Scalar conflictingStores;
+        /** Stat for number of memory order violations. */
+        statistics::Scalar violations;
+        /** Stat for number of loads that waited for a predicted store
+         *  they do not overlap. */
+        statistics::Scalar falseDependences;
     } stats;
 };
 
@@ -0,0 +1,95 @@
+#include "cpu/o3/ready_matrix.hh"
+
+#include <algorithm>
+
+#include "base/bitfield.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+ReadyMatrix::ReadyMatrix(size_t num_slots)
+    : numSlots(num_slots), numWords((num_slots + 63) / 64),
+      ready(MaxThreads * Num_OpClasses * numWords, 0),
+      anyReady(MaxThreads * numWords, 0),
+      candidates(MaxThreads * numWords, 0)
+{
+}
+
+void
+ReadyMatrix::setReady(ThreadID tid, size_t idx, OpClass op_class)
+{
+    const size_t pos = idx % numSlots;
+    const uint64_t bit = 1ULL << (pos % 64);
+    readyWords(tid, op_class)[pos / 64] |= bit;
+    anyReady[tid * numWords + pos / 64] |= bit;
+}
+
+void
+ReadyMatrix::clearReady(ThreadID tid, size_t idx, OpClass op_class)
+{
+    const size_t pos = idx % numSlots;
+    const uint64_t bit = 1ULL << (pos % 64);
+    readyWords(tid, op_class)[pos / 64] &= ~bit;
+    anyReady[tid * numWords + pos / 64] &= ~bit;
+    candidates[tid * numWords + pos / 64] &= ~bit;
+}
+
+bool
+ReadyMatrix::any() const
+{
+    return std::any_of(anyReady.begin(), anyReady.end(),
+                       [](uint64_t word) { return word != 0; });
+}
+
+void
+ReadyMatrix::reset()
+{
+    std::fill(ready.begin(), ready.end(), 0);
+    std::fill(anyReady.begin(), anyReady.end(), 0);
+    std::fill(candidates.begin(), candidates.end(), 0);
+}
+
+void
+ReadyMatrix::startSelect()
+{
+    candidates = anyReady;
+}
+
+void
+ReadyMatrix::blockOpClass(OpClass op_class)
+{
+    for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+        const uint64_t *words = readyWords(tid, op_class);
+        uint64_t *cand = &candidates[tid * numWords];
+        for (size_t w = 0; w < numWords; w++)
+            cand[w] &= ~words[w];
+    }
+}
+
+ssize_t
+ReadyMatrix::oldestCandidate(ThreadID tid, size_t head) const
+{
+    const uint64_t *cand = &candidates[tid * numWords];
+    const size_t head_pos = head % numSlots;
+
+    // Scan from the word of the head, ignoring the bits before it, and
+    // wrap around to that word again for the bits the first scan skipped.
+    // Bits past the tail of the list are never set.
+    size_t w = head_pos / 64;
+    uint64_t word = cand[w] & (~0ULL << (head_pos % 64));
+    for (size_t n = 0; n <= numWords; n++) {
+        if (word) {
+            const size_t pos = w * 64 + findLsbSet(word);
+            return head + (pos + numSlots - head_pos) % numSlots;
+        }
+        w = (w + 1) % numWords;
+        word = cand[w];
+    }
+    return -1;
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,99 @@
+#ifndef __CPU_O3_READY_MATRIX_HH__
+#define __CPU_O3_READY_MATRIX_HH__
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/o3/limits.hh"
+#include "cpu/op_class.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Ready instructions of the IQ, kept as one bit vector per thread and op
+ * class. The bits are indexed by the position of the instructions in the
+ * IQ instruction list of their thread, which is a ring in program order,
+ * so scanning the bits circularly from the position of the head visits
+ * the ready instructions oldest first, a machine word at a time.
+ *
+ * Selection works in rounds. A round starts with every ready instruction
+ * as a candidate, and op classes are dropped from the candidates when no
+ * functional unit is left for them.
+ */
+class ReadyMatrix
+{
+  public:
+    /**
+     * @param num_slots Capacity of the instruction list of every thread.
+     */
+    ReadyMatrix(size_t num_slots);
+
+    /** Mark the instruction at index idx of the list of tid ready. */
+    void setReady(ThreadID tid, size_t idx, OpClass op_class);
+
+    /** Mark the instruction at index idx not ready, nor a candidate. */
+    void clearReady(ThreadID tid, size_t idx, OpClass op_class);
+
+    /** Is the instruction at index idx of the list of tid ready. */
+    bool
+    isReady(ThreadID tid, size_t idx) const
+    {
+        const size_t pos = idx % numSlots;
+        return (anyReady[tid * numWords + pos / 64] >> (pos % 64)) & 1;
+    }
+
+    /** Is any instruction ready. */
+    bool any() const;
+
+    /** Clear all the ready bits. */
+    void reset();
+
+    /** Start a selection round, making every ready instruction a
+     *  candidate. */
+    void startSelect();
+
+    /** Drop the instructions of op_class from the candidates of the
+     *  round. */
+    void blockOpClass(OpClass op_class);
+
+    /**
+     * Find the oldest candidate of a thread.
+     *
+     * @param tid The thread.
+     * @param head Index of the head of the instruction list of tid.
+     * @return Index of the oldest candidate in the list, or -1 if there
+     *         is none.
+     */
+    ssize_t oldestCandidate(ThreadID tid, size_t head) const;
+
+  private:
+    uint64_t *
+    readyWords(ThreadID tid, OpClass op_class)
+    {
+        return &ready[(tid * Num_OpClasses + op_class) * numWords];
+    }
+
+    const size_t numSlots;
+    const size_t numWords;
+
+    /** Ready bits of every thread and op class. */
+    std::vector<uint64_t> ready;
+
+    /** Ready bits of every thread, whatever the op class. */
+    std::vector<uint64_t> anyReady;
+
+    /** Ready bits of every thread still selectable in this round. */
+    std::vector<uint64_t> candidates;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_READY_MATRIX_HH__
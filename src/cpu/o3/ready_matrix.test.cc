@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "cpu/o3/ready_matrix.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Oldest ready instruction of the allowed op classes, by a linear walk. */
+ssize_t
+naiveOldest(const std::vector<int> &op_classes, size_t head, size_t size,
+            const std::vector<bool> &blocked, size_t num_slots)
+{
+    for (size_t idx = head; idx < head + size; idx++) {
+        int op_class = op_classes[idx % num_slots];
+        if (op_class >= 0 && !blocked[op_class])
+            return idx;
+    }
+    return -1;
+}
+
+} // anonymous namespace
+
+/** The scan wraps around the ring, but never returns older slots. */
+TEST(ReadyMatrixTest, WrapAround)
+{
+    o3::ReadyMatrix matrix(100);
+    matrix.setReady(0, 205, IntAluOp);
+    matrix.setReady(0, 250, IntAluOp);
+    matrix.startSelect();
+    EXPECT_EQ(matrix.oldestCandidate(0, 198), 205);
+    EXPECT_EQ(matrix.oldestCandidate(0, 230), 250);
+    EXPECT_EQ(matrix.oldestCandidate(1, 198), -1);
+
+    matrix.clearReady(0, 205, IntAluOp);
+    EXPECT_FALSE(matrix.isReady(0, 205));
+    EXPECT_EQ(matrix.oldestCandidate(0, 198), 250);
+
+    EXPECT_TRUE(matrix.any());
+    matrix.reset();
+    EXPECT_FALSE(matrix.any());
+}
+
+/** Blocked op classes stop being candidates until the next round. */
+TEST(ReadyMatrixTest, BlockOpClass)
+{
+    o3::ReadyMatrix matrix(64);
+    matrix.setReady(0, 3, IntAluOp);
+    matrix.setReady(0, 7, FloatAddOp);
+    matrix.setReady(1, 1, IntAluOp);
+    matrix.startSelect();
+    matrix.blockOpClass(IntAluOp);
+    EXPECT_EQ(matrix.oldestCandidate(0, 0), 7);
+    EXPECT_EQ(matrix.oldestCandidate(1, 0), -1);
+
+    matrix.startSelect();
+    EXPECT_EQ(matrix.oldestCandidate(0, 0), 3);
+    EXPECT_EQ(matrix.oldestCandidate(1, 0), 1);
+}
+
+/** Random rings against a linear walk, with sizes around word bounds. */
+TEST(ReadyMatrixTest, RandomRings)
+{
+    std::mt19937_64 rng(0x5eed);
+    const std::vector<OpClass> classes = {IntAluOp, IntMultOp, FloatAddOp,
+                                          MemReadOp};
+
+    for (size_t num_slots : {1, 63, 64, 65, 200, 512}) {
+        o3::ReadyMatrix matrix(num_slots);
+        std::vector<int> op_classes(num_slots, -1);
+        size_t head = 0;
+
+        for (int step = 0; step < 2000; step++) {
+            // Advance the ring and refill it with random ready bits
+            for (size_t idx = head; idx < head + num_slots; idx++) {
+                if (op_classes[idx % num_slots] >= 0) {
+                    matrix.clearReady(0, idx, OpClass(
+                        op_classes[idx % num_slots]));
+                    op_classes[idx % num_slots] = -1;
+                }
+            }
+            head += rng() % (3 * num_slots);
+            const size_t size = rng() % (num_slots + 1);
+            for (size_t idx = head; idx < head + size; idx++) {
+                if (rng() % 4 == 0) {
+                    OpClass op_class = classes[rng() % classes.size()];
+                    matrix.setReady(0, idx, op_class);
+                    op_classes[idx % num_slots] = op_class;
+                }
+            }
+
+            std::vector<bool> blocked(Num_OpClasses, false);
+            matrix.startSelect();
+            for (OpClass op_class : classes) {
+                ASSERT_EQ(matrix.oldestCandidate(0, head),
+                          naiveOldest(op_classes, head, size, blocked,
+                                      num_slots))
+                    << "num_slots " << num_slots << " step " << step;
+                matrix.blockOpClass(op_class);
+                blocked[op_class] = true;
+            }
+        }
+    }
+}
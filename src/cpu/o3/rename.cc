@@ -451,6 +451,22 @@ Rename::tick()
 
 }
 
+bool
+Rename::canSkipStalledCycles()
+{
+    for (ThreadID tid : *activeThreads) {
+        if (renameStatus[tid] != Blocked || !checkStall(tid))
+            return false;
+    }
+    return true;
+}
+
+void
+Rename::skipStalledCycles(Cycles cycles)
+{
+    stats.blockCycles += activeThreads->size() * cycles;
+}
+
 void
 Rename::rename(bool &status_change, ThreadID tid)
 {
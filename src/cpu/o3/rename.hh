@@ -195,6 +195,12 @@ class Rename
      */
     void tick();
 
+    /** Can the stage go without ticking, stalled in its current state. */
+    bool canSkipStalledCycles();
+
+    /** Account for cycles spent stalled without ticking. */
+    void skipStalledCycles(Cycles cycles);
+
     /** Debugging function used to dump history buffer of renamings. */
     void dumpHistory();
 
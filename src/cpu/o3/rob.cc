@@ -59,6 +59,7 @@ ROB::ROB(CPU *_cpu, const BaseO3CPUParams &params)
     : robPolicy(params.smtROBPolicy),
       cpu(_cpu),
       numEntries(params.numROBEntries),
+      instList(MaxThreads, CircularQueue<DynInstPtr>(numEntries)),
       squashWidth(params.squashWidth),
       numInstsInROB(0),
       numThreads(params.numThreads),
@@ -104,6 +105,11 @@ void
 ROB::resetState()
 {
     for (ThreadID tid = 0; tid  < MaxThreads; tid++) {
+        while (!instList[tid].empty()) {
+            instList[tid].back() = nullptr;
+            instList[tid].pop_back();
+        }
+        instList[tid].flush();
         threadEntries[tid] = 0;
         squashIt[tid] = instList[tid].end();
         squashedSeqNum[tid] = 0;
@@ -206,6 +212,7 @@ ROB::insertInst(const DynInstPtr &inst)
 
     ThreadID tid = inst->threadNumber;
 
+    assert(!instList[tid].full());
     instList[tid].push_back(inst);
 
     //Set Up head iterator if this is the 1st instruction in the ROB
@@ -237,11 +244,10 @@ ROB::retireHead(ThreadID tid)
 
     assert(numInstsInROB > 0);
 
-    // Get the head ROB instruction by copying it and remove it from the list
-    InstIt head_it = instList[tid].begin();
-
-    DynInstPtr head_inst = std::move(*head_it);
-    instList[tid].erase(head_it);
+    // Get the head ROB instruction by moving it out of its slot, which
+    // leaves the slot cleared, and remove it from the list
+    DynInstPtr head_inst = std::move(instList[tid].front());
+    instList[tid].pop_front();
 
     assert(head_inst->readyToCommit());
 
@@ -275,6 +281,12 @@ ROB::isHeadReady(ThreadID tid)
     return false;
 }
 
+void
+ROB::skipStalledCycles(Cycles cycles)
+{
+    stats.reads += cycles;
+}
+
 bool
 ROB::canCommit()
 {
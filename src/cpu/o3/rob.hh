@@ -41,10 +41,12 @@
 #ifndef __CPU_O3_ROB_HH__
 #define __CPU_O3_ROB_HH__
 
+#include <list>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -72,7 +74,7 @@ class ROB
 {
   public:
     typedef std::pair<RegIndex, RegIndex> UnmapInfo;
-    typedef typename std::list<DynInstPtr>::iterator InstIt;
+    typedef typename CircularQueue<DynInstPtr>::iterator InstIt;
 
     /** Possible ROB statuses. */
     enum Status
@@ -159,6 +161,10 @@ class ROB
     /** Is the oldest instruction across a particular thread ready. */
     bool isHeadReady(ThreadID tid);
 
+    /** Account for the reads of a head that was not ready for a number
+     *  of cycles. */
+    void skipStalledCycles(Cycles cycles);
+
     /** Is there any commitable head instruction across all threads ready. */
     bool canCommit();
 
@@ -285,8 +291,10 @@ class ROB
     /** Max Insts a Thread Can Have in the ROB */
     unsigned maxEntries[MaxThreads];
 
-    /** ROB List of Instructions */
-    std::list<DynInstPtr> instList[MaxThreads];
+    /** ROB List of Instructions, one ring of numEntries slots per thread.
+     *  Retired slots are cleared so that they don't keep the instructions
+     *  alive until they are reused. */
+    std::vector<CircularQueue<DynInstPtr>> instList;
 
     /** Number of instructions that can be squashed in a single cycle. */
     unsigned squashWidth;
@@ -308,7 +316,7 @@ class ROB
      *  when squashing, the instructions are marked as squashed but not
      *  immediately removed, meaning the tail iterator remains the same before
      *  and after a squash.
-     *  This will always be set to cpu->instList.end() if it is invalid.
+     *  This will always be set to instList[tid].end() if it is invalid.
      */
     InstIt squashIt[MaxThreads];
 
@@ -0,0 +1,136 @@
+#include "cpu/o3/store_distance.hh"
+
+#include "base/cprintf.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/StoreDistance.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+StoreDistance::StoreDistance(unsigned table_size, unsigned max_distance,
+                             unsigned confidence_bits)
+    : table(table_size, Entry(confidence_bits)),
+      maxDistance(max_distance), confidenceBits(confidence_bits)
+{
+    fatal_if(table_size != 0 && !isPowerOf2(table_size),
+             "Invalid store distance table size %d", table_size);
+    fatal_if(confidence_bits == 0,
+             "Store distance predictor needs confidence bits");
+}
+
+StoreDistance::Entry *
+StoreDistance::findEntry(Addr PC, bool allocate)
+{
+    if (table.empty()) {
+        auto it = idealTable.find(PC);
+        if (it == idealTable.end()) {
+            if (!allocate)
+                return nullptr;
+            it = idealTable.emplace(PC, Entry(confidenceBits)).first;
+        }
+        return &it->second;
+    }
+
+    // Instructions are at least 2-byte aligned
+    Entry &entry = table[(PC >> 1) & (table.size() - 1)];
+    if (allocate || (entry.valid && entry.tag == PC))
+        return &entry;
+    return nullptr;
+}
+
+void
+StoreDistance::violation(Addr store_PC, InstSeqNum store_seq_num,
+                         Addr load_PC, InstSeqNum load_seq_num)
+{
+    // Count the stores between the store and the load, skipping the
+    // stores younger than the load
+    unsigned distance = 0;
+    auto it = stores.rbegin();
+    for (; it != stores.rend() && *it > store_seq_num; ++it) {
+        if (*it < load_seq_num)
+            distance++;
+    }
+
+    if (it == stores.rend() || *it != store_seq_num) {
+        DPRINTF(StoreDistance, "Store %#x [sn:%lli] is too far from load "
+                "%#x [sn:%lli]\n", store_PC, store_seq_num, load_PC,
+                load_seq_num);
+        return;
+    }
+
+    Entry *entry = findEntry(load_PC, true);
+    entry->valid = true;
+    entry->tag = load_PC;
+    entry->distance = distance;
+    entry->confidence.saturate();
+
+    DPRINTF(StoreDistance, "Load %#x depends on store %#x at distance %d\n",
+            load_PC, store_PC, distance);
+}
+
+void
+StoreDistance::falseDependence(Addr load_PC)
+{
+    Entry *entry = findEntry(load_PC, false);
+    if (entry) {
+        entry->confidence--;
+        DPRINTF(StoreDistance, "False dependence of load %#x, confidence "
+                "%d\n", load_PC, (unsigned)entry->confidence);
+    }
+}
+
+void
+StoreDistance::insertStore(Addr store_PC, InstSeqNum store_seq_num,
+                           ThreadID tid)
+{
+    stores.push_back(store_seq_num);
+    if (stores.size() > maxDistance + 1)
+        stores.pop_front();
+}
+
+InstSeqNum
+StoreDistance::checkInst(Addr PC)
+{
+    Entry *entry = findEntry(PC, false);
+    if (!entry || entry->confidence == 0 ||
+        entry->distance >= stores.size()) {
+        return 0;
+    }
+
+    InstSeqNum store = stores[stores.size() - 1 - entry->distance];
+    DPRINTF(StoreDistance, "Inst %#x depends on store [sn:%lli] at "
+            "distance %d\n", PC, store, entry->distance);
+    return store;
+}
+
+void
+StoreDistance::squash(InstSeqNum squashed_num, ThreadID tid)
+{
+    while (!stores.empty() && stores.back() > squashed_num)
+        stores.pop_back();
+}
+
+void
+StoreDistance::clear()
+{
+    for (auto &entry : table)
+        entry.valid = false;
+    idealTable.clear();
+    stores.clear();
+}
+
+void
+StoreDistance::dump()
+{
+    cprintf("stores.size(): %i\n", stores.size());
+    for (int i = 0; i < stores.size(); i++)
+        cprintf("%i: [sn:%lli]\n", i, stores[i]);
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,91 @@
+#ifndef __CPU_O3_STORE_DISTANCE_HH__
+#define __CPU_O3_STORE_DISTANCE_HH__
+
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "cpu/o3/mem_dep_predictor.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Store distance memory dependence predictor, as used by "NoSQ: Store-Load
+ * Communication without a Store Queue" by Sha, Martin and Roth. A load
+ * that caused an ordering violation remembers how many stores separated
+ * it from the store it conflicted with, and its later instances wait for
+ * the store at that distance.
+ *
+ * Instead of clearing the predictor periodically, an entry loses
+ * confidence whenever its load waits for a store it does not overlap, and
+ * stops predicting when it has no confidence left.
+ */
+class StoreDistance : public MemDepPredictor
+{
+  public:
+    /**
+     * @param table_size Number of entries of the distance table, which is
+     *        direct-mapped and tagged. A size of 0 makes the table
+     *        unbounded, so that loads never alias nor get evicted.
+     * @param max_distance Largest store distance that is predicted.
+     * @param confidence_bits Width of the confidence counters.
+     */
+    StoreDistance(unsigned table_size, unsigned max_distance,
+                  unsigned confidence_bits);
+
+    void violation(Addr store_PC, InstSeqNum store_seq_num,
+                   Addr load_PC, InstSeqNum load_seq_num) override;
+
+    void falseDependence(Addr load_PC) override;
+
+    void insertStore(Addr store_PC, InstSeqNum store_seq_num,
+                     ThreadID tid) override;
+
+    InstSeqNum checkInst(Addr PC) override;
+
+    void squash(InstSeqNum squashed_num, ThreadID tid) override;
+
+    void clear() override;
+
+    void dump() override;
+
+  private:
+    struct Entry
+    {
+        Entry(unsigned confidence_bits) : confidence(confidence_bits) {}
+
+        bool valid = false;
+        Addr tag = 0;
+        /** Number of stores between the load and its producer. */
+        unsigned distance = 0;
+        SatCounter8 confidence;
+    };
+
+    /** Find the entry of a load, or the entry to replace if allocate. */
+    Entry *findEntry(Addr PC, bool allocate);
+
+    /** Direct-mapped distance table, empty when unbounded. */
+    std::vector<Entry> table;
+
+    /** Distance table when unbounded. */
+    std::unordered_map<Addr, Entry> idealTable;
+
+    const unsigned maxDistance;
+
+    const unsigned confidenceBits;
+
+    /** Sequence numbers of the most recent stores, oldest first. */
+    std::deque<InstSeqNum> stores;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_STORE_DISTANCE_HH__
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "cpu/o3/store_distance.hh"
+
+using namespace gem5;
+
+/** Loads wait for the store at the distance of their last violation. */
+TEST(StoreDistanceTest, PredictDistance)
+{
+    o3::StoreDistance pred(64, 15, 2);
+    const Addr load_pc = 0x1000;
+
+    for (InstSeqNum sn : {10, 12, 14})
+        pred.insertStore(0x2000, sn, 0);
+    EXPECT_EQ(pred.checkInst(load_pc), 0);
+
+    // Store 10 conflicted with load 15, two stores in between
+    pred.violation(0x2000, 10, load_pc, 15);
+    EXPECT_EQ(pred.checkInst(load_pc), 10);
+
+    pred.insertStore(0x2000, 16, 0);
+    EXPECT_EQ(pred.checkInst(load_pc), 12);
+
+    // Squashed stores are not counted anymore
+    pred.squash(13, 0);
+    EXPECT_EQ(pred.checkInst(load_pc), 0);
+    pred.insertStore(0x2000, 17, 0);
+    pred.insertStore(0x2000, 18, 0);
+    EXPECT_EQ(pred.checkInst(load_pc), 12);
+}
+
+/** Stores younger than the load do not count in its distance. */
+TEST(StoreDistanceTest, YoungerStores)
+{
+    o3::StoreDistance pred(0, 15, 2);
+    for (InstSeqNum sn : {10, 12, 20, 22})
+        pred.insertStore(0x2000, sn, 0);
+
+    pred.violation(0x2000, 10, 0x1000, 15);
+    pred.insertStore(0x2000, 24, 0);
+    EXPECT_EQ(pred.checkInst(0x1000), 22);
+}
+
+/** Entries stop predicting when their confidence runs out. */
+TEST(StoreDistanceTest, FalseDependences)
+{
+    o3::StoreDistance pred(64, 15, 2);
+    pred.insertStore(0x2000, 10, 0);
+    pred.violation(0x2000, 10, 0x1000, 11);
+
+    pred.falseDependence(0x1000);
+    pred.falseDependence(0x1000);
+    EXPECT_EQ(pred.checkInst(0x1000), 10);
+    pred.falseDependence(0x1000);
+    EXPECT_EQ(pred.checkInst(0x1000), 0);
+
+    pred.violation(0x2000, 10, 0x1000, 11);
+    EXPECT_EQ(pred.checkInst(0x1000), 10);
+}
+
+/** Stores further than the largest distance are not tracked. */
+TEST(StoreDistanceTest, MaxDistance)
+{
+    o3::StoreDistance pred(64, 1, 2);
+    for (InstSeqNum sn : {10, 12, 14})
+        pred.insertStore(0x2000, sn, 0);
+
+    pred.violation(0x2000, 10, 0x1000, 15);
+    EXPECT_EQ(pred.checkInst(0x1000), 0);
+
+    pred.violation(0x2000, 12, 0x1000, 15);
+    EXPECT_EQ(pred.checkInst(0x1000), 12);
+}
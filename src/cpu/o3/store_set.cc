@@ -117,7 +117,8 @@ StoreSet::init(uint64_t clear_period, int _SSIT_size, int _LFST_size)
 
 
 void
-StoreSet::violation(Addr store_PC, Addr load_PC)
+StoreSet::violation(Addr store_PC, InstSeqNum store_seq_num,
+                    Addr load_PC, InstSeqNum load_seq_num)
 {
     int load_index = calcIndex(load_PC);
     int store_index = calcIndex(store_PC);
@@ -192,6 +193,9 @@ StoreSet::violation(Addr store_PC, Addr load_PC)
 void
 StoreSet::checkClear()
 {
+    if (clearPeriod == 0)
+        return;
+
     memOpsPred++;
     if (memOpsPred > clearPeriod) {
         DPRINTF(StoreSet, "Wiping predictor state beacuse %d ld/st executed\n",
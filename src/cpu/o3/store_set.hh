@@ -36,6 +36,7 @@
 
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
+#include "cpu/o3/mem_dep_predictor.hh"
 
 namespace gem5
 {
@@ -59,7 +60,7 @@ struct ltseqnum
  * stands for Store Set ID, SSIT stands for Store Set ID Table, and
  * LFST is Last Fetched Store Table.
  */
-class StoreSet
+class StoreSet : public MemDepPredictor
 {
   public:
     typedef unsigned SSID;
@@ -72,47 +73,50 @@ class StoreSet
     StoreSet(uint64_t clear_period, int SSIT_size, int LFST_size);
 
     /** Default destructor. */
-    ~StoreSet();
+    ~StoreSet() override;
 
     /** Initializes the store set predictor with the given table sizes. */
     void init(uint64_t clear_period, int SSIT_size, int LFST_size);
 
     /** Records a memory ordering violation between the younger load
      * and the older store. */
-    void violation(Addr store_PC, Addr load_PC);
+    void violation(Addr store_PC, InstSeqNum store_seq_num,
+                   Addr load_PC, InstSeqNum load_seq_num) override;
 
     /** Clears the store set predictor every so often so that all the
      * entries aren't used and stores are constantly predicted as
-     * conflicting.
+     * conflicting. A clear period of 0 never clears it.
      */
     void checkClear();
 
     /** Inserts a load into the store set predictor.  This does nothing but
      * is included in case other predictors require a similar function.
      */
-    void insertLoad(Addr load_PC, InstSeqNum load_seq_num);
+    void insertLoad(Addr load_PC, InstSeqNum load_seq_num) override;
 
     /** Inserts a store into the store set predictor.  Updates the
      * LFST if the store has a valid SSID. */
-    void insertStore(Addr store_PC, InstSeqNum store_seq_num, ThreadID tid);
+    void insertStore(Addr store_PC, InstSeqNum store_seq_num,
+                     ThreadID tid) override;
 
     /** Checks if the instruction with the given PC is dependent upon
      * any store.  @return Returns the sequence number of the store
      * instruction this PC is dependent upon.  Returns 0 if none.
      */
-    InstSeqNum checkInst(Addr PC);
+    InstSeqNum checkInst(Addr PC) override;
 
     /** Records this PC/sequence number as issued. */
-    void issued(Addr issued_PC, InstSeqNum issued_seq_num, bool is_store);
+    void issued(Addr issued_PC, InstSeqNum issued_seq_num,
+                bool is_store) override;
 
     /** Squashes for a specific thread until the given sequence number. */
-    void squash(InstSeqNum squashed_num, ThreadID tid);
+    void squash(InstSeqNum squashed_num, ThreadID tid) override;
 
     /** Resets all tables. */
-    void clear();
+    void clear() override;
 
     /** Debug function to dump the contents of the store list. */
-    void dump();
+    void dump() override;
 
   private:
     /** Calculates the index into the SSIT based on the PC. */
@@ -147,6 +147,21 @@ LocalBP::getLocalIndex(Addr &branch_addr)
     return (branch_addr >> instShiftAmt) & indexMask;
 }
 
+void
+LocalBP::serialize(CheckpointOut &cp) const
+{
+    SERIALIZE_CONTAINER(localCtrs);
+}
+
+void
+LocalBP::unserialize(CheckpointIn &cp)
+{
+    // Checkpoints without predictor state leave the predictor cold
+    if (!cp.entryExists(Serializable::currentSection(), "localCtrs"))
+        return;
+
+    UNSERIALIZE_CONTAINER(localCtrs);
+}
 
 } // namespace branch_prediction
 } // namespace gem5
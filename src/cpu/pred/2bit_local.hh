@@ -83,6 +83,9 @@ class LocalBP : public BPredUnit
     void squash(ThreadID tid, void * &bp_history) override
     { assert(bp_history == NULL); }
 
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
   private:
     /**
      *  Returns the taken/not taken prediction given the value of the
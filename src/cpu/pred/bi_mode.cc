@@ -251,5 +251,27 @@ BiModeBP::updateGlobalHistReg(ThreadID tid, bool taken)
     globalHistoryReg[tid] &= historyRegisterMask;
 }
 
+void
+BiModeBP::serialize(CheckpointOut &cp) const
+{
+    SERIALIZE_CONTAINER(globalHistoryReg);
+    SERIALIZE_CONTAINER(choiceCounters);
+    SERIALIZE_CONTAINER(takenCounters);
+    SERIALIZE_CONTAINER(notTakenCounters);
+}
+
+void
+BiModeBP::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "choiceCounters"))
+        return;
+
+    arrayParamIn(cp, "globalHistoryReg", globalHistoryReg.data(),
+                 globalHistoryReg.size());
+    UNSERIALIZE_CONTAINER(choiceCounters);
+    UNSERIALIZE_CONTAINER(takenCounters);
+    UNSERIALIZE_CONTAINER(notTakenCounters);
+}
+
 } // namespace branch_prediction
 } // namespace gem5
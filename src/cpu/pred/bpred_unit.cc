@@ -94,6 +94,16 @@ BPredUnit::drainSanityCheck() const
         assert(ph.empty());
 }
 
+void
+BPredUnit::setISA(BaseISA *isa)
+{
+    btb->setISA(isa);
+    if (ras)
+        ras->setISA(isa);
+    if (iPred)
+        iPred->setISA(isa);
+}
+
 
 bool
 BPredUnit::predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
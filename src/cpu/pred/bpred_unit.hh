@@ -87,6 +87,13 @@ class BPredUnit : public SimObject
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
 
+    /**
+     * Set the ISA of the CPU using the predictor. The BTB, RAS and
+     * indirect predictor use it to restore their targets from a
+     * checkpoint.
+     */
+    void setISA(BaseISA *isa);
+
     /**
      * Predicts whether or not the instruction is a taken branch, and the
      * target of the branch if it is taken.
@@ -52,6 +52,8 @@
 namespace gem5
 {
 
+class BaseISA;
+
 namespace branch_prediction
 {
 
@@ -65,6 +67,12 @@ class BranchTargetBuffer : public ClockedObject
 
     virtual void memInvalidate() override = 0;
 
+    /**
+     * Set the ISA of the CPU using the BTB, which creates the targets of
+     * the entries restored from a checkpoint.
+     */
+    void setISA(BaseISA *_isa) { isa = _isa; }
+
     /** Checks if a branch address is in the BTB. Intended as a quick check
      *  before calling lookup. Does not update statistics.
      *  @param inst_PC The address of the branch to look up.
@@ -110,6 +118,9 @@ class BranchTargetBuffer : public ClockedObject
     /** Number of the threads for which the branch history is maintained. */
     const unsigned numThreads;
 
+    /** The ISA creating the restored targets, see setISA. */
+    BaseISA *isa = nullptr;
+
     struct BranchTargetBufferStats : public statistics::Group
     {
         BranchTargetBufferStats(statistics::Group *parent);
@@ -52,6 +52,8 @@
 namespace gem5
 {
 
+class BaseISA;
+
 namespace branch_prediction
 {
 
@@ -68,6 +70,12 @@ class IndirectPredictor : public SimObject
 
     virtual void reset() {};
 
+    /**
+     * Set the ISA of the CPU using the predictor, which creates the targets of
+     * the entries restored from a checkpoint.
+     */
+    void setISA(BaseISA *_isa) { isa = _isa; }
+
     /**
      * Predicts the indirect target of an indirect branch.
      * @param tid Thread ID of the branch.
@@ -117,6 +125,10 @@ class IndirectPredictor : public SimObject
      * @param i_history The pointer to the history object.
      */
     virtual void commit(ThreadID tid, InstSeqNum sn, void * &i_history) = 0;
+
+  protected:
+    /** The ISA creating the restored targets, see setISA. */
+    BaseISA *isa = nullptr;
 };
 
 } // namespace branch_prediction
@@ -389,5 +389,67 @@ LoopPredictor::getSizeInBits() const
         loopTableAgeBits + useDirectionBit);
 }
 
+void
+LoopPredictor::serialize(CheckpointOut &cp) const
+{
+    const size_t size = 1ULL << logSizeLoopPred;
+    std::vector<uint16_t> numIter(size), currentIter(size),
+        currentIterSpec(size), tag(size);
+    std::vector<uint8_t> confidence(size), age(size);
+    std::vector<bool> dir(size);
+    for (size_t i = 0; i < size; i++) {
+        numIter[i] = ltable[i].numIter;
+        currentIter[i] = ltable[i].currentIter;
+        currentIterSpec[i] = ltable[i].currentIterSpec;
+        confidence[i] = ltable[i].confidence;
+        tag[i] = ltable[i].tag;
+        age[i] = ltable[i].age;
+        dir[i] = ltable[i].dir;
+    }
+    SERIALIZE_CONTAINER(numIter);
+    SERIALIZE_CONTAINER(currentIter);
+    SERIALIZE_CONTAINER(currentIterSpec);
+    SERIALIZE_CONTAINER(confidence);
+    SERIALIZE_CONTAINER(tag);
+    SERIALIZE_CONTAINER(age);
+    SERIALIZE_CONTAINER(dir);
+
+    SERIALIZE_SCALAR(loopUseCounter);
+}
+
+void
+LoopPredictor::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "numIter"))
+        return;
+
+    const size_t size = 1ULL << logSizeLoopPred;
+    std::vector<uint16_t> numIter(size), currentIter(size),
+        currentIterSpec(size), tag(size);
+    std::vector<uint8_t> confidence(size), age(size);
+    std::vector<bool> dir;
+    arrayParamIn(cp, "numIter", numIter.data(), size);
+    arrayParamIn(cp, "currentIter", currentIter.data(), size);
+    arrayParamIn(cp, "currentIterSpec", currentIterSpec.data(), size);
+    arrayParamIn(cp, "confidence", confidence.data(), size);
+    arrayParamIn(cp, "tag", tag.data(), size);
+    arrayParamIn(cp, "age", age.data(), size);
+    UNSERIALIZE_CONTAINER(dir);
+    fatal_if(dir.size() != size,
+             "%s: the loop table size does not match the checkpoint",
+             name());
+    for (size_t i = 0; i < size; i++) {
+        ltable[i].numIter = numIter[i];
+        ltable[i].currentIter = currentIter[i];
+        ltable[i].currentIterSpec = currentIterSpec[i];
+        ltable[i].confidence = confidence[i];
+        ltable[i].tag = tag[i];
+        ltable[i].age = age[i];
+        ltable[i].dir = dir[i];
+    }
+
+    UNSERIALIZE_SCALAR(loopUseCounter);
+}
+
 } // namespace branch_prediction
 } // namespace gem5
@@ -273,6 +273,9 @@ class LoopPredictor : public SimObject
     LoopPredictor(const LoopPredictorParams &p);
 
     size_t getSizeInBits() const;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
 };
 
 } // namespace branch_prediction
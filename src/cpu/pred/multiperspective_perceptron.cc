@@ -59,6 +59,43 @@ namespace gem5
 namespace branch_prediction
 {
 
+namespace
+{
+
+/** Checkpoint each row of a table in its own entry. */
+template <typename T>
+void
+rowsParamOut(CheckpointOut &cp, const std::string &name,
+             const std::vector<std::vector<T>> &rows)
+{
+    for (int i = 0; i < rows.size(); i++)
+        arrayParamOut(cp, csprintf("%s%d", name, i), rows[i]);
+}
+
+/** Restore a vector, which must have the size it was checkpointed with. */
+template <typename T>
+void
+sizedParamIn(CheckpointIn &cp, const std::string &name, std::vector<T> &v)
+{
+    std::vector<T> temp;
+    arrayParamIn(cp, name, temp);
+    fatal_if(temp.size() != v.size(),
+             "Size mismatch on %s:%s (Got %u, expected %u)",
+             Serializable::currentSection(), name, temp.size(), v.size());
+    v = std::move(temp);
+}
+
+template <typename T>
+void
+rowsParamIn(CheckpointIn &cp, const std::string &name,
+            std::vector<std::vector<T>> &rows)
+{
+    for (int i = 0; i < rows.size(); i++)
+        sizedParamIn(cp, csprintf("%s%d", name, i), rows[i]);
+}
+
+} // anonymous namespace
+
 int
 MultiperspectivePerceptron::xlat[] =
     {1,3,4,5,7,8,9,11,12,14,15,17,19,21,23,25,27,29,32,34,37,41,45,49,53,58,63,
@@ -128,6 +165,77 @@ MultiperspectivePerceptron::ThreadData::ThreadData(int num_filters,
     }
 }
 
+void
+MultiperspectivePerceptron::ThreadData::serialize(CheckpointOut &cp) const
+{
+    std::vector<bool> seen_taken, seen_untaken;
+    for (const auto &entry : filterTable) {
+        seen_taken.push_back(entry.seenTaken);
+        seen_untaken.push_back(entry.seenUntaken);
+    }
+    SERIALIZE_CONTAINER(seen_taken);
+    SERIALIZE_CONTAINER(seen_untaken);
+
+    rowsParamOut(cp, "acyclic_histories", acyclic_histories);
+    rowsParamOut(cp, "acyclic2_histories", acyclic2_histories);
+    rowsParamOut(cp, "blurrypath_histories", blurrypath_histories);
+    SERIALIZE_CONTAINER(ghist_words);
+    rowsParamOut(cp, "modpath_histories", modpath_histories);
+    rowsParamOut(cp, "mod_histories", mod_histories);
+    SERIALIZE_CONTAINER(path_history);
+    SERIALIZE_CONTAINER(imli_counter);
+    localHistories.serialize(cp);
+    SERIALIZE_CONTAINER(recency_stack);
+    SERIALIZE_SCALAR(last_ghist_bit);
+    SERIALIZE_SCALAR(occupancy);
+
+    SERIALIZE_CONTAINER(mpreds);
+    rowsParamOut(cp, "tables", tables);
+    for (int i = 0; i < sign_bits.size(); i++) {
+        std::vector<bool> bits;
+        for (const auto &entry : sign_bits[i])
+            bits.insert(bits.end(), entry.begin(), entry.end());
+        arrayParamOut(cp, csprintf("sign_bits%d", i), bits);
+    }
+}
+
+void
+MultiperspectivePerceptron::ThreadData::unserialize(CheckpointIn &cp)
+{
+    std::vector<bool> seen_taken(filterTable.size()),
+        seen_untaken(filterTable.size());
+    sizedParamIn(cp, "seen_taken", seen_taken);
+    sizedParamIn(cp, "seen_untaken", seen_untaken);
+    for (int i = 0; i < filterTable.size(); i++) {
+        filterTable[i].seenTaken = seen_taken[i];
+        filterTable[i].seenUntaken = seen_untaken[i];
+    }
+
+    rowsParamIn(cp, "acyclic_histories", acyclic_histories);
+    rowsParamIn(cp, "acyclic2_histories", acyclic2_histories);
+    rowsParamIn(cp, "blurrypath_histories", blurrypath_histories);
+    sizedParamIn(cp, "ghist_words", ghist_words);
+    rowsParamIn(cp, "modpath_histories", modpath_histories);
+    rowsParamIn(cp, "mod_histories", mod_histories);
+    sizedParamIn(cp, "path_history", path_history);
+    sizedParamIn(cp, "imli_counter", imli_counter);
+    localHistories.unserialize(cp);
+    sizedParamIn(cp, "recency_stack", recency_stack);
+    UNSERIALIZE_SCALAR(last_ghist_bit);
+    UNSERIALIZE_SCALAR(occupancy);
+
+    sizedParamIn(cp, "mpreds", mpreds);
+    rowsParamIn(cp, "tables", tables);
+    for (int i = 0; i < sign_bits.size(); i++) {
+        std::vector<bool> bits(2 * sign_bits[i].size());
+        sizedParamIn(cp, csprintf("sign_bits%d", i), bits);
+        for (int j = 0; j < sign_bits[i].size(); j++) {
+            sign_bits[i][j][0] = bits[2 * j];
+            sign_bits[i][j][1] = bits[2 * j + 1];
+        }
+    }
+}
+
 MultiperspectivePerceptron::MultiperspectivePerceptron(
     const MultiperspectivePerceptronParams &p) : BPredUnit(p),
     blockSize(p.block_size), pcshift(p.pcshift), threshold(p.threshold),
@@ -846,5 +954,30 @@ MultiperspectivePerceptron::squash(ThreadID tid, void * &bp_history)
     bp_history = nullptr;
 }
 
+void
+MultiperspectivePerceptron::serialize(CheckpointOut &cp) const
+{
+    SERIALIZE_SCALAR(thresholdCounter);
+    SERIALIZE_SCALAR(theta);
+    for (int tid = 0; tid < threadData.size(); tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("thread%d", tid));
+        threadData[tid]->serialize(cp);
+    }
+}
+
+void
+MultiperspectivePerceptron::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "theta"))
+        return;
+
+    UNSERIALIZE_SCALAR(thresholdCounter);
+    UNSERIALIZE_SCALAR(theta);
+    for (int tid = 0; tid < threadData.size(); tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("thread%d", tid));
+        threadData[tid]->unserialize(cp);
+    }
+}
+
 } // namespace branch_prediction
 } // namespace gem5
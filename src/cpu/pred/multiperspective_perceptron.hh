@@ -52,6 +52,7 @@
 #define __CPU_PRED_MULTIPERSPECTIVE_PERCEPTRON_HH__
 
 #include <array>
+#include <string>
 #include <vector>
 
 #include "cpu/pred/bpred_unit.hh"
@@ -229,6 +230,17 @@ class MultiperspectivePerceptron : public BPredUnit
         {
             return localHistoryLength * localHistories.size();
         }
+
+        void serialize(CheckpointOut &cp) const
+        {
+            SERIALIZE_CONTAINER(localHistories);
+        }
+
+        void unserialize(CheckpointIn &cp)
+        {
+            arrayParamIn(cp, "localHistories", localHistories.data(),
+                         localHistories.size());
+        }
     };
 
     /**
@@ -367,6 +379,9 @@ class MultiperspectivePerceptron : public BPredUnit
         std::vector<int> mpreds;
         std::vector<std::vector<short int>> tables;
         std::vector<std::vector<std::array<bool, 2>>> sign_bits;
+
+        void serialize(CheckpointOut &cp) const;
+        void unserialize(CheckpointIn &cp);
     };
     std::vector<ThreadData *> threadData;
 
@@ -1068,6 +1083,9 @@ class MultiperspectivePerceptron : public BPredUnit
                 void * &bp_history, bool squashed,
                 const StaticInstPtr & inst, Addr target) override;
     void squash(ThreadID tid, void * &bp_history) override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
 };
 
 } // namespace branch_prediction
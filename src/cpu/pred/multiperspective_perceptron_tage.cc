@@ -237,11 +237,7 @@ MPP_TAGE::updatePathAndGlobalHistory(
         path >>= 1;
         updateGHist(tHist.gHist, dir, tHist.globalHistory, tHist.ptGhist);
         tHist.pathHist = (tHist.pathHist << 1) ^ pathbit;
-        for (int i = 1; i <= nHistoryTables; i++) {
-            tHist.computeIndices[i].update(tHist.gHist);
-            tHist.computeTags[0][i].update(tHist.gHist);
-            tHist.computeTags[1][i].update(tHist.gHist);
-        }
+        tHist.folded.update(tHist.gHist);
     }
 }
 
@@ -334,6 +330,39 @@ MPP_StatisticalCorrector::getIndUpd(Addr branch_pc) const
     return ((branch_pc ^ (branch_pc >> 4)) & ((1 << (logSizeUp)) - 1));
 }
 
+void
+MPP_StatisticalCorrector::serialize(CheckpointOut &cp) const
+{
+    StatisticalCorrector::serialize(cp);
+    SERIALIZE_SCALAR(thirdH);
+    serializeGEHL(cp, "pgehl", pnb, pgehl, wp);
+    serializeGEHL(cp, "ggehl", gnb, ggehl, wg);
+
+    const MPP_SCThreadHistory *sh =
+        static_cast<const MPP_SCThreadHistory *>(scHistory);
+    paramOut(cp, "globalHist", sh->globalHist);
+    arrayParamOut(cp, "historyStack", sh->historyStack);
+    paramOut(cp, "historyStackPointer", sh->historyStackPointer);
+}
+
+void
+MPP_StatisticalCorrector::unserialize(CheckpointIn &cp)
+{
+    StatisticalCorrector::unserialize(cp);
+    if (!cp.entryExists(Serializable::currentSection(), "thirdH"))
+        return;
+
+    UNSERIALIZE_SCALAR(thirdH);
+    unserializeGEHL(cp, "pgehl", pnb, pgehl, wp);
+    unserializeGEHL(cp, "ggehl", gnb, ggehl, wg);
+
+    MPP_SCThreadHistory *sh = static_cast<MPP_SCThreadHistory *>(scHistory);
+    paramIn(cp, "globalHist", sh->globalHist);
+    arrayParamIn(cp, "historyStack", sh->historyStack.data(),
+                 sh->historyStack.size());
+    paramIn(cp, "historyStackPointer", sh->historyStackPointer);
+}
+
 void
 MPP_StatisticalCorrector::gUpdate(Addr branch_pc, bool taken, int64_t hist,
                    std::vector<int> & length, std::vector<int8_t> * tab,
@@ -200,6 +200,9 @@ class MPP_StatisticalCorrector : public StatisticalCorrector
         Addr branch_pc, bool taken, int64_t hist, std::vector<int> & length,
         std::vector<int8_t> * tab, int nbr, int logs,
         std::vector<int8_t> &w, StatisticalCorrector::BranchInfo* bi) override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
 };
 
 class MultiperspectivePerceptronTAGE : public MultiperspectivePerceptron
@@ -163,6 +163,25 @@ MPP_StatisticalCorrector_64KB::scHistoryUpdate(Addr branch_pc,
                                           corrTarget);
 }
 
+void
+MPP_StatisticalCorrector_64KB::serialize(CheckpointOut &cp) const
+{
+    MPP_StatisticalCorrector::serialize(cp);
+    serializeGEHL(cp, "sgehl", snb, sgehl, ws);
+    serializeGEHL(cp, "tgehl", tnb, tgehl, wt);
+}
+
+void
+MPP_StatisticalCorrector_64KB::unserialize(CheckpointIn &cp)
+{
+    MPP_StatisticalCorrector::unserialize(cp);
+    if (!cp.entryExists(Serializable::currentSection(), "sgehlWeights"))
+        return;
+
+    unserializeGEHL(cp, "sgehl", snb, sgehl, ws);
+    unserializeGEHL(cp, "tgehl", tnb, tgehl, wt);
+}
+
 size_t
 MPP_StatisticalCorrector_64KB::getSizeInBits() const
 {
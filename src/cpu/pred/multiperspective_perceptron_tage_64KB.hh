@@ -82,6 +82,9 @@ class MPP_StatisticalCorrector_64KB : public MPP_StatisticalCorrector
     MPP_StatisticalCorrector_64KB(
             const MPP_StatisticalCorrector_64KBParams &p);
     size_t getSizeInBits() const override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
 };
 
 class MultiperspectivePerceptronTAGE64KB :
@@ -42,6 +42,7 @@
 
 #include <iomanip>
 
+#include "arch/generic/isa.hh"
 #include "debug/RAS.hh"
 
 namespace gem5
@@ -302,7 +303,56 @@ ReturnAddrStack::commit(ThreadID tid, bool misp,
     ras_history = nullptr;
 }
 
+void
+ReturnAddrStack::serialize(CheckpointOut &cp) const
+{
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("stack%d", tid));
+        const AddrStack &stack = addrStacks[tid];
+        paramOut(cp, "usedEntries", stack.usedEntries);
+        paramOut(cp, "tos", stack.tos);
+
+        std::vector<unsigned> validEntries;
+        for (unsigned i = 0; i < stack.numEntries; i++) {
+            if (stack.addrStack[i])
+                validEntries.push_back(i);
+        }
+        SERIALIZE_CONTAINER(validEntries);
+        for (unsigned i : validEntries) {
+            ScopedCheckpointSection sec(cp, csprintf("entry%d", i));
+            stack.addrStack[i]->serialize(cp);
+        }
+    }
+}
 
+void
+ReturnAddrStack::unserialize(CheckpointIn &cp)
+{
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("stack%d", tid));
+        if (!cp.entryExists(Serializable::currentSection(), "tos"))
+            return;
+
+        AddrStack &stack = addrStacks[tid];
+        std::vector<unsigned> validEntries;
+        UNSERIALIZE_CONTAINER(validEntries);
+        fatal_if(!validEntries.empty() && !isa,
+                 "%s: no ISA to restore the RAS entries with", name());
+
+        stack.init(numEntries);
+        paramIn(cp, "usedEntries", stack.usedEntries);
+        paramIn(cp, "tos", stack.tos);
+        fatal_if(stack.tos >= numEntries || stack.usedEntries > numEntries,
+                 "%s: the RAS size does not match the checkpoint", name());
+        for (unsigned i : validEntries) {
+            fatal_if(i >= numEntries, "%s: invalid RAS entry %d in the "
+                     "checkpoint", name(), i);
+            ScopedCheckpointSection sec(cp, csprintf("entry%d", i));
+            stack.addrStack[i].reset(isa->newPCState());
+            stack.addrStack[i]->unserialize(cp);
+        }
+    }
+}
 
 ReturnAddrStack::ReturnAddrStackStats::ReturnAddrStackStats(
     statistics::Group *parent)
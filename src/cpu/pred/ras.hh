@@ -54,6 +54,8 @@
 namespace gem5
 {
 
+class BaseISA;
+
 namespace branch_prediction
 {
 
@@ -147,6 +149,15 @@ class ReturnAddrStack : public SimObject
 
     void reset();
 
+    /**
+     * Set the ISA of the CPU using the RAS, which creates the targets of
+     * the entries restored from a checkpoint.
+     */
+    void setISA(BaseISA *_isa) { isa = _isa; }
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
     /**
      * Pushes an address onto the RAS.
      * @param PC The current PC (should be a call).
@@ -206,6 +217,9 @@ class ReturnAddrStack : public SimObject
     /** The number of threads */
     unsigned numThreads;
 
+    /** The ISA creating the restored targets, see setISA. */
+    BaseISA *isa = nullptr;
+
     struct ReturnAddrStackStats : public statistics::Group
     {
         ReturnAddrStackStats(statistics::Group *parent);
@@ -40,6 +40,7 @@
 
 #include "cpu/pred/simple_btb.hh"
 
+#include "arch/generic/isa.hh"
 #include "base/intmath.hh"
 #include "base/trace.hh"
 #include "debug/BTB.hh"
@@ -154,6 +155,50 @@ SimpleBTB::getInst(ThreadID tid, Addr instPC)
     return nullptr;
 }
 
+void
+SimpleBTB::serialize(CheckpointOut &cp) const
+{
+    std::vector<unsigned> validEntries;
+    for (unsigned i = 0; i < numEntries; ++i) {
+        if (btb[i].valid)
+            validEntries.push_back(i);
+    }
+    SERIALIZE_CONTAINER(validEntries);
+
+    for (unsigned i : validEntries) {
+        ScopedCheckpointSection sec(cp, csprintf("entry%d", i));
+        paramOut(cp, "tag", btb[i].tag);
+        paramOut(cp, "tid", btb[i].tid);
+        btb[i].target->serialize(cp);
+    }
+}
+
+void
+SimpleBTB::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "validEntries"))
+        return;
+
+    std::vector<unsigned> validEntries;
+    UNSERIALIZE_CONTAINER(validEntries);
+    fatal_if(!validEntries.empty() && !isa,
+             "%s: no ISA to restore the BTB targets with", name());
+
+    memInvalidate();
+    for (unsigned i : validEntries) {
+        fatal_if(i >= numEntries, "%s: invalid BTB entry %d in the "
+                 "checkpoint", name(), i);
+        ScopedCheckpointSection sec(cp, csprintf("entry%d", i));
+        BTBEntry &entry = btb[i];
+        paramIn(cp, "tag", entry.tag);
+        paramIn(cp, "tid", entry.tid);
+        entry.target.reset(isa->newPCState());
+        entry.target->unserialize(cp);
+        entry.inst = nullptr;
+        entry.valid = true;
+    }
+}
+
 void
 SimpleBTB::update(ThreadID tid, Addr instPC,
                     const PCStateBase &target,
@@ -66,6 +66,13 @@ class SimpleBTB : public BranchTargetBuffer
                            StaticInstPtr inst = nullptr) override;
     const StaticInstPtr getInst(ThreadID tid, Addr instPC) override;
 
+    /**
+     * Checkpoint the valid entries. The static instructions are not
+     * checkpointed, so getInst misses on the restored entries.
+     */
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
 
   private:
     struct BTBEntry
@@ -38,6 +38,7 @@
 
 #include "cpu/pred/simple_indirect.hh"
 
+#include "arch/generic/isa.hh"
 #include "base/intmath.hh"
 #include "debug/Indirect.hh"
 
@@ -95,6 +96,84 @@ SimpleIndirectPredictor::reset()
 }
 
 
+void
+SimpleIndirectPredictor::serialize(CheckpointOut &cp) const
+{
+    for (ThreadID tid = 0; tid < threadInfo.size(); tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("thread%d", tid));
+        const ThreadInfo &ti = threadInfo[tid];
+        paramOut(cp, "ghr", ti.ghr);
+
+        std::vector<Addr> pcAddr, targetAddr;
+        for (const auto &entry : ti.pathHist) {
+            pcAddr.push_back(entry.pcAddr);
+            targetAddr.push_back(entry.targetAddr);
+        }
+        SERIALIZE_CONTAINER(pcAddr);
+        SERIALIZE_CONTAINER(targetAddr);
+    }
+
+    // Only the ways holding a target can hit
+    std::vector<unsigned> validWays;
+    for (unsigned i = 0; i < numSets; i++) {
+        for (unsigned j = 0; j < numWays; j++) {
+            if (targetCache[i][j].target)
+                validWays.push_back(i * numWays + j);
+        }
+    }
+    SERIALIZE_CONTAINER(validWays);
+    for (unsigned way : validWays) {
+        const IPredEntry &entry = targetCache[way / numWays][way % numWays];
+        ScopedCheckpointSection sec(cp, csprintf("way%d", way));
+        paramOut(cp, "tag", entry.tag);
+        entry.target->serialize(cp);
+    }
+}
+
+void
+SimpleIndirectPredictor::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "validWays"))
+        return;
+
+    for (ThreadID tid = 0; tid < threadInfo.size(); tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("thread%d", tid));
+        ThreadInfo &ti = threadInfo[tid];
+        paramIn(cp, "ghr", ti.ghr);
+
+        std::vector<Addr> pcAddr, targetAddr;
+        UNSERIALIZE_CONTAINER(pcAddr);
+        UNSERIALIZE_CONTAINER(targetAddr);
+        fatal_if(pcAddr.size() != targetAddr.size(),
+                 "%s: inconsistent path history in the checkpoint", name());
+        // The sequence numbers of the CPU restart with the checkpoint
+        ti.pathHist.clear();
+        for (int i = 0; i < pcAddr.size(); i++)
+            ti.pathHist.emplace_back(pcAddr[i], targetAddr[i], 0);
+    }
+
+    std::vector<unsigned> validWays;
+    UNSERIALIZE_CONTAINER(validWays);
+    fatal_if(!validWays.empty() && !isa,
+             "%s: no ISA to restore the indirect targets with", name());
+
+    for (auto &set : targetCache) {
+        for (auto &entry : set) {
+            entry.tag = 0;
+            entry.target.reset();
+        }
+    }
+    for (unsigned way : validWays) {
+        fatal_if(way >= numSets * numWays, "%s: invalid way %d in the "
+                 "checkpoint", name(), way);
+        IPredEntry &entry = targetCache[way / numWays][way % numWays];
+        ScopedCheckpointSection sec(cp, csprintf("way%d", way));
+        paramIn(cp, "tag", entry.tag);
+        entry.target.reset(isa->newPCState());
+        entry.target->unserialize(cp);
+    }
+}
+
 void
 SimpleIndirectPredictor::genIndirectInfo(ThreadID tid, void* &i_history)
 {
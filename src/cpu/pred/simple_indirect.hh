@@ -68,6 +68,9 @@ class SimpleIndirectPredictor : public IndirectPredictor
     void squash(ThreadID tid, InstSeqNum sn, void * &iHistory) override;
     void commit(ThreadID tid, InstSeqNum sn, void * &iHistory) override;
 
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
 
 
     /** ------------------
@@ -396,6 +396,72 @@ StatisticalCorrector::init()
     initBias();
 }
 
+void
+StatisticalCorrector::serializeGEHL(CheckpointOut &cp,
+    const std::string &name, unsigned numLenghts,
+    const std::vector<int8_t> *table, const std::vector<int8_t> &w) const
+{
+    for (int i = 0; i < numLenghts; i++)
+        arrayParamOut(cp, csprintf("%s%d", name, i), table[i]);
+    arrayParamOut(cp, name + "Weights", w);
+}
+
+void
+StatisticalCorrector::unserializeGEHL(CheckpointIn &cp,
+    const std::string &name, unsigned numLenghts,
+    std::vector<int8_t> *table, std::vector<int8_t> &w)
+{
+    for (int i = 0; i < numLenghts; i++) {
+        arrayParamIn(cp, csprintf("%s%d", name, i), table[i].data(),
+                     table[i].size());
+    }
+    arrayParamIn(cp, name + "Weights", w.data(), w.size());
+}
+
+void
+StatisticalCorrector::serialize(CheckpointOut &cp) const
+{
+    serializeGEHL(cp, "bwgehl", bwnb, bwgehl, wbw);
+    serializeGEHL(cp, "lgehl", lnb, lgehl, wl);
+    serializeGEHL(cp, "igehl", inb, igehl, wi);
+
+    SERIALIZE_CONTAINER(bias);
+    SERIALIZE_CONTAINER(biasSK);
+    SERIALIZE_CONTAINER(biasBank);
+    SERIALIZE_CONTAINER(wb);
+    SERIALIZE_SCALAR(updateThreshold);
+    SERIALIZE_CONTAINER(pUpdateThreshold);
+    SERIALIZE_SCALAR(firstH);
+    SERIALIZE_SCALAR(secondH);
+
+    ScopedCheckpointSection sec(cp, "scHistory");
+    scHistory->serialize(cp);
+}
+
+void
+StatisticalCorrector::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "bias"))
+        return;
+
+    unserializeGEHL(cp, "bwgehl", bwnb, bwgehl, wbw);
+    unserializeGEHL(cp, "lgehl", lnb, lgehl, wl);
+    unserializeGEHL(cp, "igehl", inb, igehl, wi);
+
+    arrayParamIn(cp, "bias", bias.data(), bias.size());
+    arrayParamIn(cp, "biasSK", biasSK.data(), biasSK.size());
+    arrayParamIn(cp, "biasBank", biasBank.data(), biasBank.size());
+    arrayParamIn(cp, "wb", wb.data(), wb.size());
+    UNSERIALIZE_SCALAR(updateThreshold);
+    arrayParamIn(cp, "pUpdateThreshold", pUpdateThreshold.data(),
+                 pUpdateThreshold.size());
+    UNSERIALIZE_SCALAR(firstH);
+    UNSERIALIZE_SCALAR(secondH);
+
+    ScopedCheckpointSection sec(cp, "scHistory");
+    scHistory->unserialize(cp);
+}
+
 size_t
 StatisticalCorrector::getSizeInBits() const
 {
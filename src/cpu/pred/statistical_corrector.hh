@@ -42,6 +42,9 @@
 #ifndef __CPU_PRED_STATISTICAL_CORRECTOR_HH__
 #define __CPU_PRED_STATISTICAL_CORRECTOR_HH__
 
+#include <string>
+
+#include "base/cprintf.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/static_inst.hh"
@@ -121,6 +124,29 @@ class StatisticalCorrector : public SimObject
             localHistories[idx][entry] = hist;
         }
 
+        void
+        serialize(CheckpointOut &cp) const
+        {
+            SERIALIZE_SCALAR(bwHist);
+            SERIALIZE_SCALAR(imliCount);
+            for (int i = 0; i < numOrdinalHistories; i++) {
+                arrayParamOut(cp, csprintf("localHistories%d", i),
+                              localHistories[i]);
+            }
+        }
+
+        void
+        unserialize(CheckpointIn &cp)
+        {
+            UNSERIALIZE_SCALAR(bwHist);
+            UNSERIALIZE_SCALAR(imliCount);
+            for (int i = 0; i < numOrdinalHistories; i++) {
+                arrayParamIn(cp, csprintf("localHistories%d", i),
+                             localHistories[i].data(),
+                             localHistories[i].size());
+            }
+        }
+
       private:
         std::vector<int64_t> * localHistories;
         std::vector<int> shifts;
@@ -263,6 +289,18 @@ class StatisticalCorrector : public SimObject
         std::vector<int8_t> * & table, unsigned logNumEntries,
         std::vector<int8_t> & w, int8_t wInitValue);
 
+    /**
+     * Checkpoint the tables and weights of a GEHL predictor, see
+     * initGEHLTable.
+     * @param name Prefix of the names of the tables.
+     */
+    void serializeGEHL(CheckpointOut &cp, const std::string &name,
+        unsigned numLenghts, const std::vector<int8_t> *table,
+        const std::vector<int8_t> &w) const;
+    void unserializeGEHL(CheckpointIn &cp, const std::string &name,
+        unsigned numLenghts, std::vector<int8_t> *table,
+        std::vector<int8_t> &w);
+
     virtual void scHistoryUpdate(
         Addr branch_pc, const StaticInstPtr &inst , bool taken,
         BranchInfo * tage_bi, Addr corrTarget);
@@ -273,6 +311,9 @@ class StatisticalCorrector : public SimObject
     void init() override;
     void updateStats(bool taken, BranchInfo *bi);
 
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
     virtual void condBranchUpdate(ThreadID tid, Addr branch_pc, bool taken,
                           BranchInfo *bi, Addr corrTarget, bool bias_bit,
                           int hitBank, int altBank, int64_t phist);
@@ -99,6 +99,12 @@ TAGEBase::init()
     // its size
     assert(pathHistBits <= (sizeof(int)*8));
 
+#if TAGE_VECTOR_LOOKUP
+    // The tag matches of all the banks are collected in a 64-bit mask
+    fatal_if(nHistoryTables >= 64, "TAGE_VECTOR_LOOKUP supports at most "
+             "63 tagged tables, %s has %d", name(), nHistoryTables);
+#endif
+
     // initialize the counter to half of the period
     assert(logUResetPeriod != 0);
     tCounter = initialTCounterValue;
@@ -127,10 +133,7 @@ TAGEBase::init()
     assert(tagTableTagWidths[0] == 0);
 
     for (auto& history : threadHistory) {
-        history.computeIndices = new FoldedHistory[nHistoryTables+1];
-        history.computeTags[0] = new FoldedHistory[nHistoryTables+1];
-        history.computeTags[1] = new FoldedHistory[nHistoryTables+1];
-
+        history.folded.init(nHistoryTables + 1);
         initFoldedHistories(history);
     }
 
@@ -151,12 +154,8 @@ void
 TAGEBase::initFoldedHistories(ThreadHistory & history)
 {
     for (int i = 1; i <= nHistoryTables; i++) {
-        history.computeIndices[i].init(
-            histLengths[i], (logTagTableSizes[i]));
-        history.computeTags[0][i].init(
-            history.computeIndices[i].origLength, tagTableTagWidths[i]);
-        history.computeTags[1][i].init(
-            history.computeIndices[i].origLength, tagTableTagWidths[i]-1);
+        history.folded.init(i, histLengths[i], logTagTableSizes[i],
+                            tagTableTagWidths[i], tagTableTagWidths[i] - 1);
         DPRINTF(Tage, "HistLength:%d, TTSize:%d, TTTWidth:%d\n",
                 histLengths[i], logTagTableSizes[i], tagTableTagWidths[i]);
     }
@@ -170,6 +169,62 @@ TAGEBase::buildTageTables()
     }
 }
 
+void
+TAGEBase::serializeTageTables(CheckpointOut &cp) const
+{
+    for (int i = 1; i <= nHistoryTables; i++) {
+        serializeTageTable(cp, csprintf("gtable%d", i), gtable[i],
+                           1ULL << logTagTableSizes[i]);
+    }
+}
+
+void
+TAGEBase::unserializeTageTables(CheckpointIn &cp)
+{
+    for (int i = 1; i <= nHistoryTables; i++) {
+        unserializeTageTable(cp, csprintf("gtable%d", i), gtable[i],
+                             1ULL << logTagTableSizes[i]);
+    }
+}
+
+void
+TAGEBase::serializeTageTable(CheckpointOut &cp, const std::string &name,
+                             const TageEntry *table, size_t size) const
+{
+    ScopedCheckpointSection sec(cp, name);
+
+    std::vector<int8_t> ctr(size);
+    std::vector<uint16_t> tag(size);
+    std::vector<uint8_t> u(size);
+    for (size_t i = 0; i < size; i++) {
+        ctr[i] = table[i].ctr;
+        tag[i] = table[i].tag;
+        u[i] = table[i].u;
+    }
+    SERIALIZE_CONTAINER(ctr);
+    SERIALIZE_CONTAINER(tag);
+    SERIALIZE_CONTAINER(u);
+}
+
+void
+TAGEBase::unserializeTageTable(CheckpointIn &cp, const std::string &name,
+                               TageEntry *table, size_t size)
+{
+    ScopedCheckpointSection sec(cp, name);
+
+    std::vector<int8_t> ctr(size);
+    std::vector<uint16_t> tag(size);
+    std::vector<uint8_t> u(size);
+    arrayParamIn(cp, "ctr", ctr.data(), size);
+    arrayParamIn(cp, "tag", tag.data(), size);
+    arrayParamIn(cp, "u", u.data(), size);
+    for (size_t i = 0; i < size; i++) {
+        table[i].ctr = ctr[i];
+        table[i].tag = tag[i];
+        table[i].u = u[i];
+    }
+}
+
 void
 TAGEBase::calculateParameters()
 {
@@ -192,14 +247,8 @@ TAGEBase::btbUpdate(ThreadID tid, Addr branch_pc, BranchInfo* &bi)
         DPRINTF(Tage, "BTB miss resets prediction: %lx\n", branch_pc);
         assert(tHist.gHist == &tHist.globalHistory[tHist.ptGhist]);
         tHist.gHist[0] = 0;
-        for (int i = 1; i <= nHistoryTables; i++) {
-            tHist.computeIndices[i].comp = bi->ci[i];
-            tHist.computeTags[0][i].comp = bi->ct0[i];
-            tHist.computeTags[1][i].comp = bi->ct1[i];
-            tHist.computeIndices[i].update(tHist.gHist);
-            tHist.computeTags[0][i].update(tHist.gHist);
-            tHist.computeTags[1][i].update(tHist.gHist);
-        }
+        restoreFoldedHistories(tHist, bi);
+        tHist.folded.update(tHist.gHist);
     }
 }
 
@@ -236,7 +285,7 @@ TAGEBase::gindex(ThreadID tid, Addr pc, int bank) const
     index =
         shiftedPc ^
         (shiftedPc >> ((int) abs(logTagTableSizes[bank] - bank) + 1)) ^
-        threadHistory[tid].computeIndices[bank].comp ^
+        threadHistory[tid].folded.comp(FoldedHistories::Index, bank) ^
         F(threadHistory[tid].pathHist, hlen, bank);
 
     return (index & ((1ULL << (logTagTableSizes[bank])) - 1));
@@ -248,8 +297,9 @@ uint16_t
 TAGEBase::gtag(ThreadID tid, Addr pc, int bank) const
 {
     int tag = (pc >> instShiftAmt) ^
-              threadHistory[tid].computeTags[0][bank].comp ^
-              (threadHistory[tid].computeTags[1][bank].comp << 1);
+              threadHistory[tid].folded.comp(FoldedHistories::Tag0, bank) ^
+              (threadHistory[tid].folded.comp(FoldedHistories::Tag1, bank)
+               << 1);
 
     return (tag & ((1ULL << tagTableTagWidths[bank]) - 1));
 }
@@ -372,6 +422,25 @@ TAGEBase::tagePredict(ThreadID tid, Addr branch_pc,
 
         bi->hitBank = 0;
         bi->altBank = 0;
+#if TAGE_VECTOR_LOOKUP
+        // Compare the tags of all the banks in one pass, the longest
+        // and alternate matches are the two highest bits of the mask
+        uint64_t hits = 0;
+        for (int i = 1; i <= nHistoryTables; i++) {
+            hits |= uint64_t(noSkip[i] &
+                             (gtable[i][tableIndices[i]].tag ==
+                              tableTags[i])) << i;
+        }
+        if (hits) {
+            bi->hitBank = floorLog2(hits);
+            bi->hitBankIndex = tableIndices[bi->hitBank];
+            hits ^= 1ULL << bi->hitBank;
+        }
+        if (hits) {
+            bi->altBank = floorLog2(hits);
+            bi->altBankIndex = tableIndices[bi->altBank];
+        }
+#else
         //Look for the bank with longest matching history
         for (int i = nHistoryTables; i > 0; i--) {
             if (noSkip[i] &&
@@ -390,6 +459,7 @@ TAGEBase::tagePredict(ThreadID tid, Addr branch_pc,
                 break;
             }
         }
+#endif
         //computes the prediction and the alternate prediction
         if (bi->hitBank > 0) {
             if (bi->altBank > 0) {
@@ -607,17 +677,14 @@ TAGEBase::updateHistories(ThreadID tid, Addr branch_pc, bool taken,
     }
 
     //prepare next index and tag computations for user branchs
-    for (int i = 1; i <= nHistoryTables; i++)
-    {
-        if (speculative) {
-            bi->ci[i]  = tHist.computeIndices[i].comp;
-            bi->ct0[i] = tHist.computeTags[0][i].comp;
-            bi->ct1[i] = tHist.computeTags[1][i].comp;
+    if (speculative) {
+        for (int i = 1; i <= nHistoryTables; i++) {
+            bi->ci[i]  = tHist.folded.comp(FoldedHistories::Index, i);
+            bi->ct0[i] = tHist.folded.comp(FoldedHistories::Tag0, i);
+            bi->ct1[i] = tHist.folded.comp(FoldedHistories::Tag1, i);
         }
-        tHist.computeIndices[i].update(tHist.gHist);
-        tHist.computeTags[0][i].update(tHist.gHist);
-        tHist.computeTags[1][i].update(tHist.gHist);
     }
+    tHist.folded.update(tHist.gHist);
     DPRINTF(Tage, "Updating global histories with branch:%lx; taken?:%d, "
             "path Hist: %x; pointer:%d\n", branch_pc, taken, tHist.pathHist,
             tHist.ptGhist);
@@ -641,13 +708,18 @@ TAGEBase::squash(ThreadID tid, bool taken, TAGEBase::BranchInfo *bi,
     tHist.ptGhist = bi->ptGhist;
     tHist.gHist = &(tHist.globalHistory[tHist.ptGhist]);
     tHist.gHist[0] = (taken ? 1 : 0);
+    restoreFoldedHistories(tHist, bi);
+    tHist.folded.update(tHist.gHist);
+}
+
+void
+TAGEBase::restoreFoldedHistories(ThreadHistory &tHist,
+                                 const BranchInfo *bi)
+{
     for (int i = 1; i <= nHistoryTables; i++) {
-        tHist.computeIndices[i].comp = bi->ci[i];
-        tHist.computeTags[0][i].comp = bi->ct0[i];
-        tHist.computeTags[1][i].comp = bi->ct1[i];
-        tHist.computeIndices[i].update(tHist.gHist);
-        tHist.computeTags[0][i].update(tHist.gHist);
-        tHist.computeTags[1][i].update(tHist.gHist);
+        tHist.folded.comp(FoldedHistories::Index, i) = bi->ci[i];
+        tHist.folded.comp(FoldedHistories::Tag0, i) = bi->ct0[i];
+        tHist.folded.comp(FoldedHistories::Tag1, i) = bi->ct1[i];
     }
 }
 
@@ -805,5 +877,84 @@ TAGEBase::getSizeInBits() const {
     return bits;
 }
 
+void
+TAGEBase::serialize(CheckpointOut &cp) const
+{
+    SERIALIZE_CONTAINER(btablePrediction);
+    SERIALIZE_CONTAINER(btableHysteresis);
+    serializeTageTables(cp);
+
+    for (int tid = 0; tid < threadHistory.size(); tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("thread%d", tid));
+        const ThreadHistory &history = threadHistory[tid];
+
+        paramOut(cp, "pathHist", history.pathHist);
+        paramOut(cp, "ptGhist", history.ptGhist);
+        arrayParamOut(cp, "globalHistory", history.globalHistory,
+                      histBufferSize);
+
+        // Only the folded values change, the lengths come from the params
+        std::vector<unsigned> ci, ct0, ct1;
+        for (int i = 1; i <= nHistoryTables; i++) {
+            ci.push_back(history.folded.comp(FoldedHistories::Index, i));
+            ct0.push_back(history.folded.comp(FoldedHistories::Tag0, i));
+            ct1.push_back(history.folded.comp(FoldedHistories::Tag1, i));
+        }
+        SERIALIZE_CONTAINER(ci);
+        SERIALIZE_CONTAINER(ct0);
+        SERIALIZE_CONTAINER(ct1);
+    }
+
+    SERIALIZE_CONTAINER(useAltPredForNewlyAllocated);
+    SERIALIZE_SCALAR(tCounter);
+}
+
+void
+TAGEBase::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "btablePrediction"))
+        return;
+
+    std::vector<bool> prediction, hysteresis;
+    arrayParamIn(cp, "btablePrediction", prediction);
+    arrayParamIn(cp, "btableHysteresis", hysteresis);
+    fatal_if(prediction.size() != btablePrediction.size() ||
+             hysteresis.size() != btableHysteresis.size(),
+             "%s: the bimodal table size does not match the checkpoint",
+             name());
+    btablePrediction = std::move(prediction);
+    btableHysteresis = std::move(hysteresis);
+    unserializeTageTables(cp);
+
+    for (int tid = 0; tid < threadHistory.size(); tid++) {
+        ScopedCheckpointSection sec(cp, csprintf("thread%d", tid));
+        ThreadHistory &history = threadHistory[tid];
+
+        paramIn(cp, "pathHist", history.pathHist);
+        paramIn(cp, "ptGhist", history.ptGhist);
+        fatal_if(history.ptGhist < 0 || history.ptGhist >= histBufferSize,
+                 "%s: invalid history pointer in the checkpoint", name());
+        arrayParamIn(cp, "globalHistory", history.globalHistory,
+                     histBufferSize);
+        history.gHist = &history.globalHistory[history.ptGhist];
+
+        std::vector<unsigned> ci(nHistoryTables), ct0(nHistoryTables),
+            ct1(nHistoryTables);
+        arrayParamIn(cp, "ci", ci.data(), nHistoryTables);
+        arrayParamIn(cp, "ct0", ct0.data(), nHistoryTables);
+        arrayParamIn(cp, "ct1", ct1.data(), nHistoryTables);
+        for (int i = 1; i <= nHistoryTables; i++) {
+            history.folded.comp(FoldedHistories::Index, i) = ci[i - 1];
+            history.folded.comp(FoldedHistories::Tag0, i) = ct0[i - 1];
+            history.folded.comp(FoldedHistories::Tag1, i) = ct1[i - 1];
+        }
+    }
+
+    arrayParamIn(cp, "useAltPredForNewlyAllocated",
+                 useAltPredForNewlyAllocated.data(),
+                 useAltPredForNewlyAllocated.size());
+    UNSERIALIZE_SCALAR(tCounter);
+}
+
 } // namespace branch_prediction
 } // namespace gem5
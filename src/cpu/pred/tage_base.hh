@@ -48,9 +48,11 @@
 #ifndef __CPU_PRED_TAGE_BASE_HH__
 #define __CPU_PRED_TAGE_BASE_HH__
 
+#include <string>
 #include <vector>
 
 #include "base/statistics.hh"
+#include "config/tage_vector_lookup.hh"
 #include "cpu/null_static_inst.hh"
 #include "cpu/static_inst.hh"
 #include "params/TAGEBase.hh"
@@ -68,6 +70,9 @@ class TAGEBase : public SimObject
     TAGEBase(const TAGEBaseParams &p);
     void init() override;
 
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
   protected:
     // Prediction Structures
 
@@ -80,36 +85,104 @@ class TAGEBase : public SimObject
         TageEntry() : ctr(0), tag(0), u(0) { }
     };
 
-    // Folded History Table - compressed history
+    // Folded History Tables - compressed histories
     // to mix with instruction PC to index partially
     // tagged tables.
-    struct FoldedHistory
+    //
+    // Every table has one history folded to the width of its index
+    // and two folded to the width of its tag. They are kept as
+    // parallel arrays, one lane per table and kind of history, so
+    // that the histories of all the tables are updated by a single
+    // loop over contiguous data.
+    class FoldedHistories
     {
-        unsigned comp;
-        int compLength;
-        int origLength;
-        int outpoint;
-        int bufferSize;
+      public:
+        enum Kind { Index, Tag0, Tag1, NumKinds };
+
+        /** Allocate the histories of tables 0 to num_tables - 1. */
+        void
+        init(int num_tables)
+        {
+            numTables = num_tables;
+            const size_t num_lanes = NumKinds * numTables;
+            comps.assign(num_lanes, 0);
+            origLengths.assign(num_lanes, 0);
+            outpoints.assign(num_lanes, 0);
+            compLengths.assign(num_lanes, 0);
+            masks.assign(num_lanes, 0);
+            outgoing.assign(num_lanes, 0);
+        }
+
+        /** Set the lengths of the histories of a table. */
+        void
+        init(int bank, int original_length, int index_length,
+             int tag0_length, int tag1_length)
+        {
+            const int lengths[NumKinds] =
+                { index_length, tag0_length, tag1_length };
+            for (int kind = 0; kind < NumKinds; kind++) {
+                const size_t l = lane(Kind(kind), bank);
+                origLengths[l] = original_length;
+                compLengths[l] = lengths[kind];
+                outpoints[l] = original_length % lengths[kind];
+                masks[l] = (1ULL << lengths[kind]) - 1;
+            }
+        }
+
+        unsigned &
+        comp(Kind kind, int bank)
+        {
+            return comps[lane(kind, bank)];
+        }
 
-        FoldedHistory()
+        unsigned
+        comp(Kind kind, int bank) const
         {
-            comp = 0;
+            return comps[lane(kind, bank)];
         }
 
-        void init(int original_length, int compressed_length)
+        /** Shift the newest outcome h[0] in all the histories. */
+        void
+        update(const uint8_t *h)
         {
-            origLength = original_length;
-            compLength = compressed_length;
-            outpoint = original_length % compressed_length;
+            const size_t num_lanes = comps.size();
+#if TAGE_VECTOR_LOOKUP
+            // Gather the outcomes leaving the histories first, so that
+            // the folding loop is free of indirect loads and vectorizes
+            for (size_t l = 0; l < num_lanes; l++)
+                outgoing[l] = h[origLengths[l]];
+            const unsigned newest = h[0];
+            for (size_t l = 0; l < num_lanes; l++) {
+                unsigned c = (comps[l] << 1) | newest;
+                c ^= outgoing[l] << outpoints[l];
+                c ^= c >> compLengths[l];
+                comps[l] = c & masks[l];
+            }
+#else
+            for (size_t l = 0; l < num_lanes; l++) {
+                unsigned c = (comps[l] << 1) | h[0];
+                c ^= h[origLengths[l]] << outpoints[l];
+                c ^= c >> compLengths[l];
+                comps[l] = c & masks[l];
+            }
+#endif
         }
 
-        void update(uint8_t * h)
+      private:
+        size_t
+        lane(Kind kind, int bank) const
         {
-            comp = (comp << 1) | h[0];
-            comp ^= h[origLength] << outpoint;
-            comp ^= (comp >> compLength);
-            comp &= (1ULL << compLength) - 1;
+            return kind * numTables + bank;
         }
+
+        int numTables = 0;
+        std::vector<unsigned> comps;
+        std::vector<int> origLengths;
+        std::vector<unsigned> outpoints;
+        std::vector<unsigned> compLengths;
+        std::vector<unsigned> masks;
+        /** Scratch space of update. */
+        std::vector<unsigned> outgoing;
     };
 
   public:
@@ -353,6 +426,24 @@ class TAGEBase : public SimObject
      */
     virtual void buildTageTables();
 
+    /**
+     * Checkpoint the tagged tables. Subclasses that share the tables
+     * between banks in buildTageTables checkpoint each table once.
+     */
+    virtual void serializeTageTables(CheckpointOut &cp) const;
+    virtual void unserializeTageTables(CheckpointIn &cp);
+
+    /**
+     * Checkpoint a tagged table in its own section.
+     * @param name Name of the section.
+     * @param table The table.
+     * @param size Number of entries of the table.
+     */
+    void serializeTageTable(CheckpointOut &cp, const std::string &name,
+                            const TageEntry *table, size_t size) const;
+    void unserializeTageTable(CheckpointIn &cp, const std::string &name,
+                              TageEntry *table, size_t size);
+
     /**
      * Calculates the history lengths
      * and some other paramters in derived classes
@@ -457,8 +548,7 @@ class TAGEBase : public SimObject
         int ptGhist;
 
         // Speculative folded histories.
-        FoldedHistory *computeIndices;
-        FoldedHistory *computeTags[2];
+        FoldedHistories folded;
     };
 
     std::vector<ThreadHistory> threadHistory;
@@ -468,6 +558,9 @@ class TAGEBase : public SimObject
      */
     virtual void initFoldedHistories(ThreadHistory & history);
 
+    /** Restore the folded histories saved in bi before its update. */
+    void restoreFoldedHistories(ThreadHistory &tHist, const BranchInfo *bi);
+
     int *histLengths;
     int *tableIndices;
     int *tableTags;
@@ -136,6 +136,24 @@ TAGE_SC_L_TAGE::buildTageTables()
     }
 }
 
+void
+TAGE_SC_L_TAGE::serializeTageTables(CheckpointOut &cp) const
+{
+    serializeTageTable(cp, "shortTagsTable", gtable[1],
+                       shortTagsTageFactor * (1 << logTagTableSize));
+    serializeTageTable(cp, "longTagsTable", gtable[firstLongTagTable],
+                       longTagsTageFactor * (1 << logTagTableSize));
+}
+
+void
+TAGE_SC_L_TAGE::unserializeTageTables(CheckpointIn &cp)
+{
+    unserializeTageTable(cp, "shortTagsTable", gtable[1],
+                         shortTagsTageFactor * (1 << logTagTableSize));
+    unserializeTageTable(cp, "longTagsTable", gtable[firstLongTagTable],
+                         longTagsTageFactor * (1 << logTagTableSize));
+}
+
 void
 TAGE_SC_L_TAGE::calculateIndicesAndTags(
     ThreadID tid, Addr pc, TAGEBase::BranchInfo* bi)
@@ -199,7 +217,7 @@ TAGE_SC_L_TAGE::gindex(ThreadID tid, Addr pc, int bank) const
     // pc is not shifted by instShiftAmt in this implementation
     index = shortPc ^
             (shortPc >> ((int) abs(logTagTableSizes[bank] - bank) + 1)) ^
-            threadHistory[tid].computeIndices[bank].comp ^
+            threadHistory[tid].folded.comp(FoldedHistories::Index, bank) ^
             F(threadHistory[tid].pathHist, hlen, bank);
 
     index = gindex_ext(index, bank);
@@ -265,11 +283,7 @@ TAGE_SC_L_TAGE::updatePathAndGlobalHistory(
             // The 8KB implementation does not do this truncation
             tHist.pathHist = (tHist.pathHist & ((1ULL << pathHistBits) - 1));
         }
-        for (int i = 1; i <= nHistoryTables; i++) {
-            tHist.computeIndices[i].update(tHist.gHist);
-            tHist.computeTags[0][i].update(tHist.gHist);
-            tHist.computeTags[1][i].update(tHist.gHist);
-        }
+        tHist.folded.update(tHist.gHist);
     }
 }
 
@@ -111,6 +111,9 @@ class TAGE_SC_L_TAGE : public TAGEBase
 
     void buildTageTables() override;
 
+    void serializeTageTables(CheckpointOut &cp) const override;
+    void unserializeTageTables(CheckpointIn &cp) override;
+
     void calculateIndicesAndTags(
         ThreadID tid, Addr branch_pc, TAGEBase::BranchInfo* bi) override;
 
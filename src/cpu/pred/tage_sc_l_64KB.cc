@@ -206,8 +206,9 @@ uint16_t
 TAGE_SC_L_TAGE_64KB::gtag(ThreadID tid, Addr pc, int bank) const
 {
     // very similar to the TAGE implementation, but w/o shifting the pc
-    int tag = pc ^ threadHistory[tid].computeTags[0][bank].comp ^
-              (threadHistory[tid].computeTags[1][bank].comp << 1);
+    const FoldedHistories &folded = threadHistory[tid].folded;
+    int tag = pc ^ folded.comp(FoldedHistories::Tag0, bank) ^
+              (folded.comp(FoldedHistories::Tag1, bank) << 1);
 
     return (tag & ((1ULL << tagTableTagWidths[bank]) - 1));
 }
@@ -309,6 +310,34 @@ TAGE_SC_L_TAGE_64KB::handleTAGEUpdate(Addr branch_pc, bool taken,
     }
 }
 
+void
+TAGE_SC_L_64KB_StatisticalCorrector::serialize(CheckpointOut &cp) const
+{
+    StatisticalCorrector::serialize(cp);
+    serializeGEHL(cp, "pgehl", pnb, pgehl, wp);
+    serializeGEHL(cp, "sgehl", snb, sgehl, ws);
+    serializeGEHL(cp, "tgehl", tnb, tgehl, wt);
+    serializeGEHL(cp, "imgehl", imnb, imgehl, wim);
+    arrayParamOut(cp, "imHist",
+                  static_cast<SC_64KB_ThreadHistory *>(scHistory)->imHist);
+}
+
+void
+TAGE_SC_L_64KB_StatisticalCorrector::unserialize(CheckpointIn &cp)
+{
+    StatisticalCorrector::unserialize(cp);
+    if (!cp.entryExists(Serializable::currentSection(), "pgehlWeights"))
+        return;
+
+    unserializeGEHL(cp, "pgehl", pnb, pgehl, wp);
+    unserializeGEHL(cp, "sgehl", snb, sgehl, ws);
+    unserializeGEHL(cp, "tgehl", tnb, tgehl, wt);
+    unserializeGEHL(cp, "imgehl", imnb, imgehl, wim);
+    std::vector<int64_t> &im_hist =
+        static_cast<SC_64KB_ThreadHistory *>(scHistory)->imHist;
+    arrayParamIn(cp, "imHist", im_hist.data(), im_hist.size());
+}
+
 TAGE_SC_L_64KB::TAGE_SC_L_64KB(const TAGE_SC_L_64KBParams &params)
   : TAGE_SC_L(params)
 {
@@ -130,6 +130,9 @@ class TAGE_SC_L_64KB_StatisticalCorrector : public StatisticalCorrector
 
     void gUpdates(ThreadID tid, Addr pc, bool taken, BranchInfo* bi,
             int64_t phist) override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
 };
 
 class TAGE_SC_L_64KB : public TAGE_SC_L
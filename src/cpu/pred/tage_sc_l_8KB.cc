@@ -138,6 +138,27 @@ TAGE_SC_L_8KB_StatisticalCorrector::gUpdates(ThreadID tid, Addr pc, bool taken,
     gUpdate(pc, taken, sh->imliCount, im, igehl, inb, logInb, wi, bi);
 }
 
+void
+TAGE_SC_L_8KB_StatisticalCorrector::serialize(CheckpointOut &cp) const
+{
+    StatisticalCorrector::serialize(cp);
+    serializeGEHL(cp, "ggehl", gnb, ggehl, wg);
+    paramOut(cp, "globalHist",
+             static_cast<SC_8KB_ThreadHistory *>(scHistory)->globalHist);
+}
+
+void
+TAGE_SC_L_8KB_StatisticalCorrector::unserialize(CheckpointIn &cp)
+{
+    StatisticalCorrector::unserialize(cp);
+    if (!cp.entryExists(Serializable::currentSection(), "ggehlWeights"))
+        return;
+
+    unserializeGEHL(cp, "ggehl", gnb, ggehl, wg);
+    paramIn(cp, "globalHist",
+            static_cast<SC_8KB_ThreadHistory *>(scHistory)->globalHist);
+}
+
 TAGE_SC_L_8KB::TAGE_SC_L_8KB(const TAGE_SC_L_8KBParams &params)
   : TAGE_SC_L(params)
 {
@@ -149,12 +170,8 @@ TAGE_SC_L_TAGE_8KB::initFoldedHistories(ThreadHistory & history)
     // Some hardcoded values are used here
     // (they do not seem to depend on any parameter)
     for (int i = 1; i <= nHistoryTables; i++) {
-        history.computeIndices[i].init(
-            histLengths[i], 17 + (2 * ((i - 1) / 2) % 4));
-        history.computeTags[0][i].init(
-            history.computeIndices[i].origLength, 13);
-        history.computeTags[1][i].init(
-            history.computeIndices[i].origLength, 11);
+        history.folded.init(i, histLengths[i],
+                            17 + (2 * ((i - 1) / 2) % 4), 13, 11);
         DPRINTF(TageSCL, "HistLength:%d, TTSize:%d, TTTWidth:%d\n",
                 histLengths[i], logTagTableSizes[i], tagTableTagWidths[i]);
     }
@@ -170,16 +187,17 @@ TAGE_SC_L_TAGE_8KB::gindex_ext(int index, int bank) const
 uint16_t
 TAGE_SC_L_TAGE_8KB::gtag(ThreadID tid, Addr pc, int bank) const
 {
-    int tag = (threadHistory[tid].computeIndices[bank - 1].comp << 2) ^ pc ^
+    const FoldedHistories &folded = threadHistory[tid].folded;
+    int tag = (folded.comp(FoldedHistories::Index, bank - 1) << 2) ^ pc ^
               (pc >> instShiftAmt) ^
-              threadHistory[tid].computeIndices[bank].comp;
+              folded.comp(FoldedHistories::Index, bank);
     int hlen = (histLengths[bank] > pathHistBits) ? pathHistBits :
                                                     histLengths[bank];
 
     tag = (tag >> 1) ^ ((tag & 1) << 10) ^
            F(threadHistory[tid].pathHist, hlen, bank);
-    tag ^= threadHistory[tid].computeTags[0][bank].comp ^
-           (threadHistory[tid].computeTags[1][bank].comp << 1);
+    tag ^= folded.comp(FoldedHistories::Tag0, bank) ^
+           (folded.comp(FoldedHistories::Tag1, bank) << 1);
 
     return ((tag ^ (tag >> tagTableTagWidths[bank]))
             & ((1ULL << tagTableTagWidths[bank]) - 1));
@@ -320,6 +320,31 @@ TournamentBP::squash(ThreadID tid, void * &bp_history)
     bp_history = nullptr;
 }
 
+void
+TournamentBP::serialize(CheckpointOut &cp) const
+{
+    SERIALIZE_CONTAINER(localCtrs);
+    SERIALIZE_CONTAINER(localHistoryTable);
+    SERIALIZE_CONTAINER(globalCtrs);
+    SERIALIZE_CONTAINER(globalHistory);
+    SERIALIZE_CONTAINER(choiceCtrs);
+}
+
+void
+TournamentBP::unserialize(CheckpointIn &cp)
+{
+    if (!cp.entryExists(Serializable::currentSection(), "localCtrs"))
+        return;
+
+    UNSERIALIZE_CONTAINER(localCtrs);
+    arrayParamIn(cp, "localHistoryTable", localHistoryTable.data(),
+                 localHistoryTable.size());
+    UNSERIALIZE_CONTAINER(globalCtrs);
+    arrayParamIn(cp, "globalHistory", globalHistory.data(),
+                 globalHistory.size());
+    UNSERIALIZE_CONTAINER(choiceCtrs);
+}
+
 #ifdef GEM5_DEBUG
 int
 TournamentBP::BPHistory::newCount = 0;
@@ -80,6 +80,9 @@ class TournamentBP : public BPredUnit
                 const StaticInstPtr & inst, Addr target) override;
     void squash(ThreadID tid, void * &bp_history) override;
 
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
   private:
     /**
      * Returns if the branch should be taken or not, given a counter
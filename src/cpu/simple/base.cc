@@ -103,6 +103,9 @@ BaseSimpleCPU::BaseSimpleCPU(const BaseSimpleCPUParams &p)
         threadContexts.push_back(tc);
     }
 
+    if (branchPred)
+        branchPred->setISA(p.isa[0]);
+
     if (p.checker) {
         if (numThreads != 1)
             fatal("Checker currently does not support SMT");
@@ -108,6 +108,9 @@ MAA::MAA(const MAAParams &p)
         rangeUnitsIdle[i] = true;
     }
     invalidatorIdle = true;
+    ppServedRange = nullptr;
+    streamServed.resize(num_stream_access_units);
+    indirectServed.resize(num_indirect_access_units);
     for (int i = 0; i < p.port_mem_sides_connection_count; ++i) {
         std::string portName = csprintf("%s.mem_side_port[%d]", p.name, i);
         memSidePorts.push_back(new MemSidePort(portName, this, "MemSidePort"));
@@ -159,6 +162,10 @@ void MAA::init() {
     }
 }
 
+void MAA::regProbePoints() {
+    ppServedRange = new ProbePointArg<MAAServedRange>(getProbeManager(), "ServedRange");
+}
+
 MAA::~MAA() {
     for (auto port : memSidePorts)
         delete port;
@@ -315,6 +322,7 @@ void MAA::issueInstruction() {
                     streamAccessUnits[i].scheduleExecuteInstructionEvent(num_issued++);
                     streamAccessIdle[i] = false;
                     inst->funcUniID = i;
+                    notifyServedRange(inst, true);
                     are_all_units_idle = false;
                     issued = true;
                 } else {
@@ -334,6 +342,7 @@ void MAA::issueInstruction() {
                     indirectAccessUnits[i].scheduleExecuteInstructionEvent(num_issued++);
                     indirectAccessIdle[i] = false;
                     inst->funcUniID = i;
+                    notifyServedRange(inst, true);
                     are_all_units_idle = false;
                     issued = true;
                 } else {
@@ -537,10 +546,12 @@ void MAA::finishInstructionCompute(Instruction *instruction) {
     switch (instruction->funcUniType) {
     case FuncUnitType::STREAM: {
         streamAccessIdle[instruction->funcUniID] = true;
+        notifyServedRange(instruction, false);
         break;
     }
     case FuncUnitType::INDIRECT: {
         indirectAccessIdle[instruction->funcUniID] = true;
+        notifyServedRange(instruction, false);
         break;
     }
     case FuncUnitType::ALU: {
@@ -562,6 +573,34 @@ void MAA::finishInstructionCompute(Instruction *instruction) {
         my_last_idle_tick = curTick();
     }
 }
+void MAA::notifyServedRange(Instruction *instruction, bool active) {
+    bool indirect = instruction->funcUniType == FuncUnitType::INDIRECT;
+    MAAServedRange &range = indirect ? indirectServed[instruction->funcUniID] : streamServed[instruction->funcUniID];
+    if (active) {
+        range.base = instruction->baseAddr;
+        range.indirect = indirect;
+        range.unit = instruction->funcUniID;
+        range.cid = instruction->CID;
+        if (indirect) {
+            range.start = range.end = instruction->baseAddr;
+        } else {
+            // stream words are base[min:max:stride], registers are read the same way by the stream unit
+            int word_size = instruction->WordSize();
+            int min = rf->getData<int>(instruction->src1RegID);
+            int max = rf->getData<int>(instruction->src2RegID);
+            range.start = instruction->baseAddr + (Addr)(int64_t)min * word_size;
+            range.end = instruction->baseAddr + (Addr)(int64_t)std::max(min, max) * word_size;
+        }
+    } else if (!range.active) {
+        return;
+    }
+    range.active = active;
+    DPRINTF(MAAController, "%s: %s %s range base %lx [%lx, %lx) cid %d\n", __func__, active ? "serving" : "released",
+            indirect ? "indirect" : "stream", range.base, range.start, range.end, range.cid);
+    if (ppServedRange != nullptr) {
+        ppServedRange->notify(range);
+    }
+}
 void MAA::setTileReady(int tileID, int wordSize) {
     DPRINTF(MAAController, "%s: tile[%d] is ready!\n", __func__, tileID);
     spd->setTileReady(tileID, wordSize);
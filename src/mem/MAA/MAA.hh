@@ -11,6 +11,7 @@
 #include "base/trace.hh"
 #include "base/types.hh"
 #include "mem/MAA/IF.hh"
+#include "mem/MAA/ServedRange.hh"
 #include "mem/cache/tags/base.hh"
 #include "mem/packet.hh"
 #include "mem/packet_queue.hh"
@@ -18,6 +19,7 @@
 #include "mem/request.hh"
 #include "mem/ramulator2.hh"
 #include "sim/clocked_object.hh"
+#include "sim/probe/probe.hh"
 #include "sim/system.hh"
 #include "arch/generic/mmu.hh"
 
@@ -423,6 +425,7 @@ public:
     ~MAA();
 
     void init() override;
+    void regProbePoints() override;
 
     Port &getPort(const std::string &if_name,
                   PortID idx = InvalidPortID) override;
@@ -464,6 +467,12 @@ protected:
     int lastCacheSidePortSend;
     std::unique_ptr<Packet> pendingDelete;
 
+    /** Ranges served by the stream and indirect units, notified to prefetchers */
+    ProbePointArg<MAAServedRange> *ppServedRange;
+    std::vector<MAAServedRange> streamServed;
+    std::vector<MAAServedRange> indirectServed;
+    void notifyServedRange(Instruction *instruction, bool active);
+
 public:
     struct MAAStats : public statistics::Group {
         MAAStats(statistics::Group *parent,
@@ -0,0 +1,34 @@
+#ifndef __MEM_MAA_SERVED_RANGE_HH__
+#define __MEM_MAA_SERVED_RANGE_HH__
+
+#include "base/types.hh"
+
+namespace gem5 {
+
+/**
+ * Argument of the MAA "ServedRange" probe point. The MAA notifies it when
+ * a stream or indirect instruction is issued to a functional unit
+ * (active == true) and again when the instruction finishes
+ * (active == false), so that prefetchers can stop chasing the same
+ * addresses while the MAA is serving them.
+ *
+ * Stream instructions serve the words [start, end). Indirect instructions
+ * serve base[idx[i]], of which only the target array base is known at
+ * issue time; start and end are both set to base.
+ */
+struct MAAServedRange {
+    Addr base;
+    Addr start;
+    Addr end;
+    bool indirect;
+    /** Functional unit serving the range, unique per unit type. */
+    int unit;
+    ContextID cid;
+    bool active;
+
+    bool contains(Addr addr) const { return addr >= start && addr < end; }
+};
+
+} // namespace gem5
+
+#endif // __MEM_MAA_SERVED_RANGE_HH__
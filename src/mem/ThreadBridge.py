@@ -24,6 +24,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5.params import *
+from m5.proxy import *
 from m5.SimObject import SimObject
 
 
@@ -39,14 +40,28 @@ class ThreadBridge(SimObject):
     the issue. The receiver side is expected to use the same EventQueue that
     the ThreadBridge is using.
 
-    Given that this is only used for simulation speed accelerating, only the
-    atomic and functional access are supported.
+    Atomic and functional accesses, as well as snoops, are forwarded
+    immediately after migrating to the event queue of the receiving side.
+    Timing requests and responses are instead delivered to the other event
+    queue as asynchronous (global) events after `delay` ticks. The event
+    queues merge such events at the end of each quantum, ordered by the
+    index of the queue that sent them, so that the packets of several
+    bridges feeding a same queue are serviced in the same order on every
+    run. As long as `delay` is not shorter than the simulation quantum, the
+    timing request/response path is thus deterministic. Timing snoops have
+    to be answered in place and are therefore forwarded through a
+    migration, which makes configurations relying on snooping across the
+    bridge non-deterministic within a quantum.
+
+    The event queue of the requestor side is given by `in_eventq_index`,
+    while the ThreadBridge itself (and thus the responder side) uses
+    `eventq_index`.
 
     Example:
 
     sys.initator = Initiator(eventq_index=0)
     sys.target = Target(eventq_index=1)
-    sys.bridge = ThreadBridge(eventq_index=1)
+    sys.bridge = ThreadBridge(eventq_index=1, in_eventq_index=0)
 
     sys.initator.out_port = sys.bridge.in_port
     sys.bridge.out_port = sys.target.in_port
@@ -56,5 +71,14 @@ class ThreadBridge(SimObject):
     cxx_header = "mem/thread_bridge.hh"
     cxx_class = "gem5::ThreadBridge"
 
+    in_eventq_index = Param.UInt32(
+        Self.eventq_index, "Event queue index of the in_port side"
+    )
+    delay = Param.Latency(
+        "0ns",
+        "Latency of timing packets crossing the bridge, must not be shorter "
+        "than the simulation quantum if the two sides use different queues",
+    )
+
     in_port = ResponsePort("Incoming port")
     out_port = RequestPort("Outgoing port")
@@ -154,6 +154,15 @@ class SnoopFilter(SimObject):
     # Sanity check on max capacity to track, adjust if needed.
     max_capacity = Param.MemorySize("8MiB", "Maximum capacity of snoop filter")
 
+    # By default every line cached above is tracked. Setting a number of
+    # entries bounds the filter to a set-associative structure, which
+    # invalidates the lines it evicts in the caches above.
+    entries = Param.Unsigned(0, "Number of tracked lines, 0 for unbounded")
+    assoc = Param.Unsigned(16, "Associativity of a bounded snoop filter")
+    replacement_policy = Param.BaseReplacementPolicy(
+        NULL, "Replacement policy of a bounded snoop filter (required)"
+    )
+
 
 # We use a coherent crossbar to connect multiple requestors to the L2
 # caches. Normally this crossbar would be part of the cache itself.
@@ -179,6 +179,14 @@ class BaseCache(ClockedObject):
 
     stats_pc_list = VectorParam.Addr([], "Monitor PC list in stats")
 
+    # Save the lines resident in the cache in checkpoints, and reload them
+    # when restoring, replaying them from the least to the most recently
+    # used, so that the detailed warmup after a restore can be much
+    # shorter. The restored cache may be sized differently.
+    warmup_snapshot = Param.Bool(
+        False, "Save and reload the resident lines in checkpoints"
+    )
+
 class Cache(BaseCache):
     type = "Cache"
     cxx_header = "mem/cache/cache.hh"
@@ -53,6 +53,7 @@
 #include "debug/CachePort.hh"
 #include "debug/CacheRepl.hh"
 #include "debug/CacheVerbose.hh"
+#include "debug/Drain.hh"
 #include "debug/HWPrefetch.hh"
 #include "debug/RequestSlot.hh"
 #include "mem/cache/compressors/base.hh"
@@ -64,6 +65,9 @@
 #include "params/BaseCache.hh"
 #include "params/WriteAllocator.hh"
 #include "sim/cur_tick.hh"
+#include <zlib.h>
+
+#include <algorithm>
 #include <cstdio>
 #include <string>
 
@@ -95,6 +99,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       writebackTempBlockAtomicEvent([this] { writebackTempBlockAtomic(); },
                                     name(), false,
                                     EventBase::Delayed_Writeback_Pri),
+      maintEvent([this] { processMaintQueue(); }, name()),
       blkSize(blk_size),
       lookupLatency(p.tag_latency),
       dataLatency(p.data_latency),
@@ -114,6 +119,11 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       missCount(p.max_miss_count),
       addrRanges(p.addr_ranges.begin(), p.addr_ranges.end()),
       exclAddrRanges(p.excl_addr_ranges.begin(), p.excl_addr_ranges.end()),
+      warmupSnapshot(p.warmup_snapshot),
+      snapshotRequestorId(p.warmup_snapshot ?
+                          p.system->getRequestorId(this, "snapshot") :
+                          Request::invldRequestorId),
+      snapshotBlkSize(blk_size),
       system(p.system),
       stats(*this) {
     // the MSHR queue has no reserve entries as we check the MSHR
@@ -192,6 +202,13 @@ void BaseCache::init() {
     forwardSnoops = cpuSidePort.isSnooping();
 }
 
+void BaseCache::startup() {
+    ClockedObject::startup();
+
+    if (!snapshot.empty())
+        reloadSnapshot();
+}
+
 Port &
 BaseCache::getPort(const std::string &if_name, PortID idx) {
     if (if_name == "mem_side") {
@@ -342,9 +359,19 @@ void BaseCache::handleTimingReqMiss(PacketPtr pkt, MSHR *mshr, CacheBlk *blk,
                 DPRINTF(Cache, "%s coalescing MSHR for %s\n", __func__, pkt->print());
 
                 assert(pkt->req->requestorId() < system->maxRequestors());
-                stats.cmdStats(pkt).mshrHits[pkt->req->requestorId()]++;
-                if (pkt->getRegion() != -1)
-                    stats.cmdRegionStats(pkt).mshrHits[pkt->req->requestorId()]++;
+                if (statistics::atLevel(statistics::Level::Full)) {
+                    stats.cmdStats(pkt).mshrHits[pkt->req->requestorId()]++;
+                    if (pkt->getRegion() != -1)
+                        stats.cmdRegionStats(pkt).mshrHits[pkt->req->requestorId()]++;
+                }
+
+                // A demand joining a prefetch still in flight makes the
+                // prefetch late, count it once per prefetch
+                if (prefetcher && pkt->isDemand() &&
+                    mshr->getNumTargets() == 1 &&
+                    mshr->getTarget()->pkt->cmd == MemCmd::HardPFReq) {
+                    prefetcher->prefetchLate();
+                }
 
                 // We use forward_time here because it is the same
                 // considering new targets. We have multiple
@@ -367,12 +394,14 @@ void BaseCache::handleTimingReqMiss(PacketPtr pkt, MSHR *mshr, CacheBlk *blk,
     } else {
         // no MSHR
         assert(pkt->req->requestorId() < system->maxRequestors());
-        stats.cmdStats(pkt).mshrMisses[pkt->req->requestorId()]++;
-        if (pkt->getRegion() != -1)
-            stats.cmdRegionStats(pkt).mshrMisses[pkt->req->requestorId()]++;
+        if (statistics::atLevel(statistics::Level::Full)) {
+            stats.cmdStats(pkt).mshrMisses[pkt->req->requestorId()]++;
+            if (pkt->getRegion() != -1)
+                stats.cmdRegionStats(pkt).mshrMisses[pkt->req->requestorId()]++;
+        }
 
         if (prefetcher && pkt->isDemand() && !isUncacheablePkt(pkt))
-            prefetcher->incrDemandMhsrMisses();
+            prefetcher->incrDemandMhsrMisses(pkt->getBlockAddr(blkSize));
 
         if (pkt->isEviction() || pkt->cmd == MemCmd::WriteClean) {
             // We use forward_time here because there is an
@@ -544,16 +573,17 @@ void BaseCache::recvTimingResp(PacketPtr pkt) {
     // Initial target is used just for stats
     const QueueEntry::Target *initial_tgt = mshr->getTarget();
     const Tick miss_latency = curTick() - initial_tgt->recvTime;
-    if (isUncacheablePkt(pkt)) {
-        assert(pkt->req->requestorId() < system->maxRequestors());
-        stats.cmdStats(initial_tgt->pkt).mshrUncacheableLatency[pkt->req->requestorId()] += miss_latency;
-        if (initial_tgt->pkt->getRegion() != -1)
-            stats.cmdRegionStats(initial_tgt->pkt).mshrUncacheableLatency[pkt->req->requestorId()] += miss_latency;
-    } else {
+    if (statistics::atLevel(statistics::Level::Full)) {
         assert(pkt->req->requestorId() < system->maxRequestors());
-        stats.cmdStats(initial_tgt->pkt).mshrMissLatency[pkt->req->requestorId()] += miss_latency;
-        if (initial_tgt->pkt->getRegion() != -1)
-            stats.cmdRegionStats(initial_tgt->pkt).mshrMissLatency[pkt->req->requestorId()] += miss_latency;
+        if (isUncacheablePkt(pkt)) {
+            stats.cmdStats(initial_tgt->pkt).mshrUncacheableLatency[pkt->req->requestorId()] += miss_latency;
+            if (initial_tgt->pkt->getRegion() != -1)
+                stats.cmdRegionStats(initial_tgt->pkt).mshrUncacheableLatency[pkt->req->requestorId()] += miss_latency;
+        } else {
+            stats.cmdStats(initial_tgt->pkt).mshrMissLatency[pkt->req->requestorId()] += miss_latency;
+            if (initial_tgt->pkt->getRegion() != -1)
+                stats.cmdRegionStats(initial_tgt->pkt).mshrMissLatency[pkt->req->requestorId()] += miss_latency;
+        }
     }
 
     PacketList writebacks;
@@ -946,9 +976,11 @@ BaseCache::getNextQueueEntry() {
                 // Update statistic on number of prefetches issued
                 // (hwpf_mshr_misses)
                 assert(pkt->req->requestorId() < system->maxRequestors());
-                stats.cmdStats(pkt).mshrMisses[pkt->req->requestorId()]++;
-                if (pkt->getRegion() != -1)
-                    stats.cmdRegionStats(pkt).mshrMisses[pkt->req->requestorId()]++;
+                if (statistics::atLevel(statistics::Level::Full)) {
+                    stats.cmdStats(pkt).mshrMisses[pkt->req->requestorId()]++;
+                    if (pkt->getRegion() != -1)
+                        stats.cmdRegionStats(pkt).mshrMisses[pkt->req->requestorId()]++;
+                }
 
                 // allocate an MSHR and return it, note
                 // that we send the packet straight away, so do not
@@ -984,10 +1016,13 @@ bool BaseCache::handleEvictions(std::vector<CacheBlk *> &evict_blks,
     // The victim will be replaced by a new entry, so increase the replacement
     // counter if a valid block is being replaced
     if (replacement) {
-        (*stats.replacements[MAX_CMD_REGIONS])++;
-        for (const auto &blk : evict_blks) {
-            if (blk->getRegion() != -1)
-                (*stats.replacements[blk->getRegion()])++;
+        if (statistics::atLevel(statistics::Level::Basic))
+            (*stats.replacements[MAX_CMD_REGIONS])++;
+        if (statistics::atLevel(statistics::Level::Full)) {
+            for (const auto &blk : evict_blks) {
+                if (blk->getRegion() != -1)
+                    (*stats.replacements[blk->getRegion()])++;
+            }
         }
 
         // Evict valid blocks associated to this victim block
@@ -1049,7 +1084,8 @@ bool BaseCache::updateCompressionData(CacheBlk *&blk, const uint64_t *data,
         CacheBlk *victim = nullptr;
         if (replaceExpansions || is_data_contraction) {
             victim = tags->findVictim(regenerateBlkAddr(blk),
-                                      blk->isSecure(), compression_size, evict_blks);
+                                      blk->isSecure(), compression_size, evict_blks,
+                                      tags->partitionId(blk));
 
             // It is valid to return nullptr if there is no victim
             if (!victim) {
@@ -1658,7 +1694,7 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks) {
     // Find replacement victim
     std::vector<CacheBlk *> evict_blks;
     CacheBlk *victim = tags->findVictim(addr, is_secure, blk_size_bits,
-                                        evict_blks);
+                                        evict_blks, tags->partitionId(pkt));
 
     // It is valid to return nullptr if there is no victim
     if (!victim)
@@ -1667,6 +1703,15 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks) {
     // Print victim block's information
     DPRINTF(CacheRepl, "Replacement victim: %s\n", victim->print());
 
+    // Let the prefetcher know about the demand-fetched lines its
+    // prefetches evict, to measure the pollution it causes
+    if (prefetcher && prefetcher->isPrefetchRequestor(pkt->req->requestorId())) {
+        for (const auto &evict_blk : evict_blks) {
+            if (evict_blk->isValid() && !evict_blk->wasPrefetched())
+                prefetcher->pfEvictedDemandLine(regenerateBlkAddr(evict_blk));
+        }
+    }
+
     // Try to evict blocks; if it fails, give up on allocation
     if (!handleEvictions(evict_blks, writebacks)) {
         return nullptr;
@@ -1717,8 +1762,10 @@ BaseCache::writebackBlk(CacheBlk *blk) {
     assert(blk && blk->isValid() &&
            (blk->isSet(CacheBlk::DirtyBit) || writebackClean));
 
-    (*stats.writebacks[MAX_CMD_REGIONS])[Request::wbRequestorId]++;
-    if (blk->getRegion() != -1)
+    if (statistics::atLevel(statistics::Level::Basic))
+        (*stats.writebacks[MAX_CMD_REGIONS])[Request::wbRequestorId]++;
+    if (statistics::atLevel(statistics::Level::Full) &&
+        blk->getRegion() != -1)
         (*stats.writebacks[blk->getRegion()])[Request::wbRequestorId]++;
 
     RequestPtr req = std::make_shared<Request>(
@@ -1844,6 +1891,109 @@ void BaseCache::writebackVisitor(CacheBlk &blk) {
     }
 }
 
+void BaseCache::handleMaintRange(PacketPtr pkt, bool is_timing) {
+    DPRINTF(Cache, "%s: %s\n", __func__, pkt->print());
+
+    // The caches above go first, so that their dirty lines are written
+    // through this cache once it is done with its own
+    if (forwardSnoops) {
+        if (is_timing)
+            cpuSidePort.sendTimingSnoopReq(pkt);
+        else
+            cpuSidePort.sendAtomicSnoop(pkt);
+    }
+
+    stats.maintRanges++;
+
+    const bool invalidate = pkt->req->isCacheInvalidate();
+    const Addr start = pkt->getBlockAddr(blkSize);
+    const Addr end = pkt->getAddr() + pkt->getSize();
+    std::vector<MaintTarget> targets;
+    auto visit = [&](CacheBlk &blk) {
+        if (!blk.isValid() ||
+            !(invalidate || blk.isSet(CacheBlk::DirtyBit))) {
+            return;
+        }
+        const Addr addr = regenerateBlkAddr(&blk);
+        if (addr >= start && addr < end)
+            targets.push_back({&blk, addr, blk.isSecure(), invalidate});
+    };
+
+    // Looking every line of the range up is cheaper than walking the
+    // tags only for ranges smaller than the cache
+    if ((end - start) / blkSize < tags->getNumBlocks()) {
+        for (Addr addr = start; addr < end; addr += blkSize) {
+            CacheBlk *blk = tags->findBlock(addr, pkt->isSecure());
+            if (blk)
+                visit(*blk);
+        }
+    } else {
+        tags->forEachBlk(visit);
+    }
+
+    if (!is_timing) {
+        PacketList writebacks;
+        for (const auto &target : targets) {
+            PacketPtr wb_pkt = maintainBlk(target);
+            if (wb_pkt)
+                writebacks.push_back(wb_pkt);
+        }
+        doWritebacksAtomic(writebacks);
+        return;
+    }
+
+    maintQueue.insert(maintQueue.end(), targets.begin(), targets.end());
+    if (!maintQueue.empty() && !maintEvent.scheduled())
+        schedule(maintEvent, clockEdge(lookupLatency));
+}
+
+PacketPtr
+BaseCache::maintainBlk(const MaintTarget &target) {
+    CacheBlk *blk = target.blk;
+    if (!blk->isValid() || blk->isSecure() != target.isSecure ||
+        regenerateBlkAddr(blk) != target.addr ||
+        mshrQueue.findMatch(target.addr, target.isSecure)) {
+        return nullptr;
+    }
+
+    stats.maintLines++;
+
+    PacketPtr wb_pkt = nullptr;
+    if (blk->isSet(CacheBlk::DirtyBit)) {
+        wb_pkt = writecleanBlk(blk, 0, 0);
+        // Without a destination the WriteClean would be allocated by
+        // the next cache, which may have cleaned the line already
+        wb_pkt->setWriteThrough();
+    }
+
+    if (target.invalidate) {
+        DPRINTF(Cache, "%s: invalidating %s\n", __func__, blk->print());
+        invalidateBlock(blk);
+    }
+
+    return wb_pkt;
+}
+
+void BaseCache::processMaintQueue() {
+    while (!maintQueue.empty() && !writeBuffer.isFull()) {
+        PacketPtr wb_pkt = maintainBlk(maintQueue.front());
+        maintQueue.pop_front();
+        if (wb_pkt) {
+            PacketList writebacks{wb_pkt};
+            doWritebacks(writebacks, clockEdge(forwardLatency));
+        }
+    }
+
+    if (maintQueue.empty() && drainState() == DrainState::Draining) {
+        DPRINTF(Drain, "Maintenance queue now empty, signalling drained\n");
+        signalDrainDone();
+    }
+}
+
+DrainState BaseCache::drain() {
+    return maintQueue.empty() ? DrainState::Drained : DrainState::Draining;
+}
+
 void BaseCache::invalidateVisitor(CacheBlk &blk) {
     if (blk.isSet(CacheBlk::DirtyBit))
         warn_once("Invalidating dirty cache lines. "
@@ -2009,6 +2159,9 @@ void BaseCache::serialize(CheckpointOut &cp) const {
     // cache contains dirty data.
     bool bad_checkpoint(dirty);
     SERIALIZE_SCALAR(bad_checkpoint);
+
+    if (warmupSnapshot)
+        serializeSnapshot(cp);
 }
 
 void BaseCache::unserialize(CheckpointIn &cp) {
@@ -2019,6 +2172,125 @@ void BaseCache::unserialize(CheckpointIn &cp) {
               "supported in the classic memory system. Please remove any "
               "caches or drain them properly before taking checkpoints.\n");
     }
+
+    if (warmupSnapshot)
+        unserializeSnapshot(cp);
+}
+
+void BaseCache::serializeSnapshot(CheckpointOut &cp) const {
+    std::vector<const CacheBlk *> blks;
+    tags->forEachBlk([&blks](CacheBlk &blk) {
+        if (blk.isValid())
+            blks.push_back(&blk);
+    });
+    std::stable_sort(blks.begin(), blks.end(),
+                     [](const CacheBlk *a, const CacheBlk *b) {
+                         return a->getLastTouchTick() < b->getLastTouchTick();
+                     });
+
+    std::vector<uint64_t> lines;
+    lines.reserve(blks.size());
+    for (const auto *blk : blks) {
+        uint64_t line = tags->regenerateBlkAddr(blk);
+        if (blk->isSecure())
+            line |= SnapshotSecure;
+        if (blk->isSet(CacheBlk::WritableBit))
+            line |= SnapshotWritable;
+        lines.push_back(line);
+    }
+
+    std::string snapshot_file = name() + ".snapshot.gz";
+    uint64_t snapshot_lines = lines.size();
+    unsigned snapshot_blk_size = blkSize;
+    SERIALIZE_SCALAR(snapshot_file);
+    SERIALIZE_SCALAR(snapshot_lines);
+    SERIALIZE_SCALAR(snapshot_blk_size);
+
+    std::string filepath = CheckpointIn::dir() + "/" + snapshot_file;
+    gzFile file = gzopen(filepath.c_str(), "wb");
+    if (file == NULL)
+        fatal("Can't open cache snapshot file '%s'\n", snapshot_file);
+
+    // Lines are written in chunks, as gzwrite takes an int length
+    const size_t chunk = 1 << 20;
+    for (size_t i = 0; i < lines.size(); i += chunk) {
+        const size_t n = std::min(chunk, lines.size() - i);
+        const int len = n * sizeof(uint64_t);
+        if (gzwrite(file, lines.data() + i, len) != len)
+            fatal("Write failed on cache snapshot file '%s'\n", snapshot_file);
+    }
+
+    if (gzclose(file))
+        fatal("Close failed on cache snapshot file '%s'\n", snapshot_file);
+}
+
+void BaseCache::unserializeSnapshot(CheckpointIn &cp) {
+    std::string snapshot_file;
+    if (!UNSERIALIZE_OPT_SCALAR(snapshot_file)) {
+        warn("%s: the checkpoint has no cache snapshot, the cache starts "
+             "cold\n", name());
+        return;
+    }
+    uint64_t snapshot_lines;
+    unsigned snapshot_blk_size;
+    UNSERIALIZE_SCALAR(snapshot_lines);
+    UNSERIALIZE_SCALAR(snapshot_blk_size);
+
+    std::string filepath = cp.getCptDir() + "/" + snapshot_file;
+    gzFile file = gzopen(filepath.c_str(), "rb");
+    if (file == NULL)
+        fatal("Can't open cache snapshot file '%s'\n", snapshot_file);
+
+    snapshot.resize(snapshot_lines);
+    const size_t chunk = 1 << 20;
+    for (size_t i = 0; i < snapshot.size(); i += chunk) {
+        const size_t n = std::min(chunk, snapshot.size() - i);
+        const int len = n * sizeof(uint64_t);
+        if (gzread(file, snapshot.data() + i, len) != len)
+            fatal("Read failed on cache snapshot file '%s'\n", snapshot_file);
+    }
+
+    if (gzclose(file))
+        fatal("Close failed on cache snapshot file '%s'\n", snapshot_file);
+
+    snapshotBlkSize = snapshot_blk_size;
+}
+
+void BaseCache::reloadSnapshot() {
+    DPRINTF(Cache, "%s: reloading %d lines\n", __func__, snapshot.size());
+
+    for (const uint64_t line : snapshot) {
+        const Addr line_addr = line & ~SnapshotFlagsMask;
+        const bool is_secure = line & SnapshotSecure;
+        const bool writable = line & SnapshotWritable;
+
+        // A snapshot line is split, or lines are merged, if the block
+        // size of the cache changed
+        for (Addr addr = line_addr & ~Addr(blkSize - 1);
+             addr < line_addr + snapshotBlkSize; addr += blkSize) {
+            RequestPtr req = std::make_shared<Request>(
+                addr, blkSize, is_secure ? Request::SECURE : 0,
+                snapshotRequestorId);
+            Packet pkt(req, writable ? MemCmd::ReadExReq :
+                                       MemCmd::ReadSharedReq);
+
+            Cycles lat;
+            if (tags->accessBlock(&pkt, lat))
+                continue;
+
+            pkt.allocate();
+            memSidePort.sendAtomic(&pkt);
+
+            PacketList writebacks;
+            CacheBlk *blk = handleFill(&pkt, nullptr, writebacks, true);
+            if (blk == tempBlock)
+                invalidateBlock(tempBlock);
+            doWritebacksAtomic(writebacks);
+        }
+    }
+
+    snapshot.clear();
+    snapshot.shrink_to_fit();
 }
 
 BaseCache::CacheCmdStats::CacheCmdStats(BaseCache &c,
@@ -2165,6 +2437,11 @@ void BaseCache::CacheCmdStats::regStatsFromParent() {
 
 BaseCache::CacheStats::CacheStats(BaseCache &c)
     : statistics::Group(&c), cache(c),
+      ADD_STAT(maintRanges, statistics::units::Count::get(),
+               "number of bulk cache maintenance operations"),
+      ADD_STAT(maintLines, statistics::units::Count::get(),
+               "number of lines cleaned by bulk cache maintenance "
+               "operations"),
       cmd(MemCmd::NUM_MEM_CMDS),
       cmdRegions(MAX_CMD_REGIONS) {
     for (int idx = 0; idx < MAX_CMD_REGIONS + 1; ++idx) {
@@ -2638,6 +2915,11 @@ void BaseCache::MemSidePort::recvTimingSnoopReq(PacketPtr pkt) {
     // Snoops shouldn't happen when bypassing caches
     assert(!cache->system->bypassCaches());
 
+    if (pkt->isMaintRange()) {
+        cache->handleMaintRange(pkt, true);
+        return;
+    }
+
     // handle snooping requests
     cache->recvTimingSnoopReq(pkt);
 }
@@ -2646,6 +2928,11 @@ Tick BaseCache::MemSidePort::recvAtomicSnoop(PacketPtr pkt) {
     // Snoops shouldn't happen when bypassing caches
     assert(!cache->system->bypassCaches());
 
+    if (pkt->isMaintRange()) {
+        cache->handleMaintRange(pkt, false);
+        return 0;
+    }
+
     return cache->recvAtomicSnoop(pkt);
 }
 
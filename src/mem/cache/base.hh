@@ -48,6 +48,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <deque>
 #include <string>
 
 #include "base/addr_range.hh"
@@ -400,6 +401,8 @@ protected:
 
         if (wasFull && !writeBuffer.isFull()) {
             clearBlocked(Blocked_NoWBBuffers);
+            if (!maintQueue.empty() && !maintEvent.scheduled())
+                schedule(maintEvent, clockEdge());
         }
     }
 
@@ -679,6 +682,53 @@ protected:
      */
     EventFunctionWrapper writebackTempBlockAtomicEvent;
 
+    /**
+     * Line to clean, and possibly invalidate, for a bulk cache
+     * maintenance operation. The block is only a hint found when the
+     * operation arrived, and is checked again before the line is
+     * cleaned.
+     */
+    struct MaintTarget {
+        CacheBlk *blk;
+        Addr addr;
+        bool isSecure;
+        bool invalidate;
+    };
+
+    /** Lines left to clean by bulk cache maintenance operations. */
+    std::deque<MaintTarget> maintQueue;
+
+    /**
+     * Clean the lines of the maintenance queue for as long as the write
+     * buffer has room for their writebacks. Freeing write buffer entries
+     * resumes it.
+     */
+    void processMaintQueue();
+    EventFunctionWrapper maintEvent;
+
+    /**
+     * Clean, and invalidate if requested, a line of a bulk cache
+     * maintenance operation. A dirty line is written through the caches
+     * below, down to memory. Lines replaced since the operation arrived,
+     * and lines with a request in flight, are left alone.
+     *
+     * @return The WriteClean of a dirty line, or nullptr.
+     */
+    PacketPtr maintainBlk(const MaintTarget &target);
+
+    /**
+     * Handle a bulk cache maintenance operation (MaintRangeReq) snooped
+     * from below. The caches above handle it first, then the lines of
+     * the range present in this cache are found, with a lookup per line
+     * for small ranges, and a single walk of the tags otherwise. In
+     * timing mode the lines are cleaned in the background, pipelining
+     * their writebacks through the write buffer.
+     *
+     * @param pkt The operation, covering [addr, addr + size).
+     * @param is_timing Whether the operation is a timing snoop.
+     */
+    void handleMaintRange(PacketPtr pkt, bool is_timing);
+
     /**
      * When a block is overwriten, its compression information must be updated,
      * and it may need to be recompressed. If the compression size changes, the
@@ -975,6 +1025,50 @@ protected:
     */
     const AddrRangeList exclAddrRanges;
 
+    /**
+     * Whether checkpoints save a snapshot of the lines resident in the
+     * cache, which is reloaded when restoring them.
+     */
+    const bool warmupSnapshot;
+
+    /** Requestor id of the fills reloading a snapshot. */
+    const RequestorID snapshotRequestorId;
+
+    /** Flags of a snapshot line, in the low bits of its address. */
+    enum SnapshotFlags : uint64_t {
+        SnapshotSecure = 0x1,
+        SnapshotWritable = 0x2,
+        SnapshotFlagsMask = 0x3
+    };
+
+    /**
+     * Lines of the snapshot of a restored checkpoint, from the least to
+     * the most recently used, with their SnapshotFlags.
+     */
+    std::vector<uint64_t> snapshot;
+
+    /** Block size of the cache the snapshot was taken from. */
+    unsigned snapshotBlkSize;
+
+    /**
+     * Write the valid lines, from the least to the most recently used,
+     * to a compressed file of the checkpoint directory.
+     */
+    void serializeSnapshot(CheckpointOut &cp) const;
+
+    /** Read the snapshot of a checkpoint, if it has one. */
+    void unserializeSnapshot(CheckpointIn &cp);
+
+    /**
+     * Reload the lines of the restored snapshot. Each line is fetched
+     * with an atomic miss, so that the caches and snoop filters below
+     * track it as usual, and lines that are present already are just
+     * touched. Replaying the lines from the least to the most recently
+     * used rebuilds the replacement state, whatever the size of this
+     * cache compared to the one the snapshot was taken from.
+     */
+    void reloadSnapshot();
+
 public:
     /** System we are currently operating in. */
     System *system;
@@ -1141,6 +1235,12 @@ public:
          */
         std::vector<statistics::Scalar *> dataContractions;
 
+        /** Number of bulk cache maintenance operations. */
+        statistics::Scalar maintRanges;
+
+        /** Number of lines cleaned by bulk cache maintenance operations. */
+        statistics::Scalar maintLines;
+
         /** Per-command statistics */
         std::vector<std::unique_ptr<CacheCmdStats>> cmd;
         std::vector<std::vector<std::unique_ptr<CacheCmdStats>>> cmdRegions;
@@ -1156,6 +1256,8 @@ public:
 
     void init() override;
 
+    void startup() override;
+
     Port &getPort(const std::string &if_name,
                   PortID idx = InvalidPortID) override;
 
@@ -1298,8 +1400,10 @@ public:
 
     void incMissCount(PacketPtr pkt) {
         assert(pkt->req->requestorId() < system->maxRequestors());
-        stats.cmdStats(pkt).misses[pkt->req->requestorId()]++;
-        if (pkt->getRegion() != -1)
+        if (statistics::atLevel(statistics::Level::Basic))
+            stats.cmdStats(pkt).misses[pkt->req->requestorId()]++;
+        if (statistics::atLevel(statistics::Level::Full) &&
+            pkt->getRegion() != -1)
             stats.cmdRegionStats(pkt).misses[pkt->req->requestorId()]++;
         pkt->req->incAccessDepth();
         if (missCount) {
@@ -1310,8 +1414,10 @@ public:
     }
     void incHitCount(PacketPtr pkt) {
         assert(pkt->req->requestorId() < system->maxRequestors());
-        stats.cmdStats(pkt).hits[pkt->req->requestorId()]++;
-        if (pkt->getRegion() != -1)
+        if (statistics::atLevel(statistics::Level::Basic))
+            stats.cmdStats(pkt).hits[pkt->req->requestorId()]++;
+        if (statistics::atLevel(statistics::Level::Full) &&
+            pkt->getRegion() != -1)
             stats.cmdRegionStats(pkt).hits[pkt->req->requestorId()]++;
     }
 
@@ -1355,10 +1461,19 @@ public:
      */
     bool sendWriteQueuePacket(WriteQueueEntry *wq_entry);
 
+    /**
+     * The cache is drained once its maintenance queue is empty. The
+     * writebacks of the maintenance operations are drained by the write
+     * buffer.
+     */
+    DrainState drain() override;
+
     /**
      * Serialize the state of the caches
      *
-     * We currently don't support checkpointing cache state, so this panics.
+     * The data of the caches is not checkpointed, so the checkpoint is
+     * flagged as bad if the cache is dirty. The lines resident in the
+     * cache are saved if warmupSnapshot is set.
      */
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
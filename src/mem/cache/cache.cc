@@ -318,9 +318,11 @@ void Cache::handleTimingReqMiss(PacketPtr pkt, CacheBlk *blk, Tick forward_time,
         // should have flushed and have no valid block
         assert(!blk || !blk->isValid());
 
-        stats.cmdStats(pkt).mshrUncacheable[pkt->req->requestorId()]++;
-        if (pkt->getRegion() != -1)
-            stats.cmdRegionStats(pkt).mshrUncacheable[pkt->req->requestorId()]++;
+        if (statistics::atLevel(statistics::Level::Full)) {
+            stats.cmdStats(pkt).mshrUncacheable[pkt->req->requestorId()]++;
+            if (pkt->getRegion() != -1)
+                stats.cmdRegionStats(pkt).mshrUncacheable[pkt->req->requestorId()]++;
+        }
 
         if (pkt->isWrite()) {
             allocateWriteBuffer(pkt, forward_time);
@@ -788,9 +790,11 @@ void Cache::serviceMSHRTargets(MSHR *mshr, const PacketPtr pkt, CacheBlk *blk) {
                 assert(!BaseCache::isUncacheablePkt(tgt_pkt));
 
                 assert(tgt_pkt->req->requestorId() < system->maxRequestors());
-                stats.cmdStats(tgt_pkt).missLatency[tgt_pkt->req->requestorId()] += completion_time - target.recvTime;
-                if (tgt_pkt->getRegion() != -1)
-                    stats.cmdRegionStats(tgt_pkt).missLatency[tgt_pkt->req->requestorId()] += completion_time - target.recvTime;
+                if (statistics::atLevel(statistics::Level::Full)) {
+                    stats.cmdStats(tgt_pkt).missLatency[tgt_pkt->req->requestorId()] += completion_time - target.recvTime;
+                    if (tgt_pkt->getRegion() != -1)
+                        stats.cmdRegionStats(tgt_pkt).missLatency[tgt_pkt->req->requestorId()] += completion_time - target.recvTime;
+                }
 
                 if (tgt_pkt->cmd == MemCmd::LockedRMWReadReq) {
                     // We're going to leave a target in the MSHR until the
@@ -1316,9 +1320,11 @@ void Cache::recvTimingSnoopReq(PacketPtr pkt) {
         // this cache, so the behaviour is modelled after handleSnoop,
         // the difference being that instead of querying the block
         // state to determine if it is dirty and writable, we use the
-        // command and fields of the writeback packet
+        // command and fields of the writeback packet. Like in
+        // handleSnoop, cache maintenance operations are not responded
+        // to, and they leave the writeback to complete on its way down.
         bool respond = wb_pkt->cmd == MemCmd::WritebackDirty &&
-                       pkt->needsResponse();
+                       pkt->needsResponse() && !pkt->isClean();
         bool have_writable = !wb_pkt->hasSharers();
         bool invalidate = pkt->isInvalidate();
 
@@ -1339,7 +1345,8 @@ void Cache::recvTimingSnoopReq(PacketPtr pkt) {
                                    false, false);
         }
 
-        if (invalidate && wb_pkt->cmd != MemCmd::WriteClean) {
+        if (invalidate && wb_pkt->cmd != MemCmd::WriteClean &&
+            !pkt->isClean()) {
             // Invalidation trumps our writeback... discard here
             // Note: markInService will remove entry from writeback buffer.
             markInService(wb_entry);
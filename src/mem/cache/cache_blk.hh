@@ -180,6 +180,7 @@ public:
         setTaskId(other.getTaskId());
         setWhenReady(curTick());
         setRefCount(other.getRefCount());
+        _lastTouchTick = other._lastTouchTick;
         setSrcRequestorId(other.getSrcRequestorId());
         std::swap(lockList, other.lockList);
 
@@ -301,8 +302,18 @@ public:
     /** Get the number of references to this block since insertion. */
     unsigned getRefCount() const { return _refCount; }
 
-    /** Get the number of references to this block since insertion. */
-    void increaseRefCount() { _refCount++; }
+    /** Count a reference to the block, made at the current tick. */
+    void
+    increaseRefCount() {
+        _refCount++;
+        _lastTouchTick = curTick();
+    }
+
+    /**
+     * Get the tick of the last reference to the block, its insertion
+     * included. Its value is only meaningful if the block is valid.
+     */
+    Tick getLastTouchTick() const { return _lastTouchTick; }
 
     /**
      * Get the block's age, that is, the number of ticks since its insertion.
@@ -507,6 +518,9 @@ private:
      */
     Tick _tickInserted = 0;
 
+    /** Tick of the last reference to the block. */
+    Tick _lastTouchTick = 0;
+
     /** Whether this block is an unaccessed hardware prefetch. */
     bool _prefetched = 0;
 
@@ -167,6 +167,23 @@ class DictionaryCompressor : public BaseDictionaryCompressor
                                                     match_location);
             }
         }
+
+        /**
+         * Get the size of the pattern getPattern() would instantiate. The
+         * pattern is built on the stack, so that looking for the best
+         * match does not allocate a pattern per candidate.
+         */
+        static std::size_t
+        getSizeBits(const DictionaryEntry& bytes,
+            const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            if (Head::isPattern(bytes, dict_bytes, match_location)) {
+                return Head(bytes, match_location).getSizeBits();
+            } else {
+                return Factory<Tail...>::getSizeBits(bytes, dict_bytes,
+                                                     match_location);
+            }
+        }
     };
 
     /**
@@ -188,6 +205,13 @@ class DictionaryCompressor : public BaseDictionaryCompressor
         {
             return std::unique_ptr<Pattern>(new Head(bytes, match_location));
         }
+
+        static std::size_t
+        getSizeBits(const DictionaryEntry& bytes,
+            const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            return Head(bytes, match_location).getSizeBits();
+        }
     };
 
     /** The dictionary. */
@@ -202,6 +226,14 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     getPattern(const DictionaryEntry& bytes, const DictionaryEntry& dict_bytes,
         const int match_location) const = 0;
 
+    /**
+     * Get the size of the pattern getPattern() would return, without
+     * instantiating it. Implemented through the factory's getSizeBits.
+     */
+    virtual std::size_t
+    getPatternSizeBits(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes, const int match_location) const = 0;
+
     /**
      * Compress data.
      *
@@ -280,8 +280,11 @@ NoncoherentCache::serviceMSHRTargets(MSHR *mshr, const PacketPtr pkt,
                 (transfer_offset ? pkt->payloadDelay : 0);
 
             assert(tgt_pkt->req->requestorId() < system->maxRequestors());
-            stats.cmdStats(tgt_pkt).missLatency[tgt_pkt->req->requestorId()] +=
-                completion_time - target.recvTime;
+            if (statistics::atLevel(statistics::Level::Full)) {
+                stats.cmdStats(tgt_pkt).missLatency[
+                    tgt_pkt->req->requestorId()] +=
+                    completion_time - target.recvTime;
+            }
 
             tgt_pkt->makeTimingResponse();
             if (pkt->isError())
@@ -89,6 +89,44 @@ class BasePrefetcher(ClockedObject):
         "4KiB", "Size of pages for virtual addresses"
     )
 
+    # Feedback-directed throttling: at the end of every interval, the
+    # accuracy, lateness and pollution of the prefetches, and the queue
+    # occupancy of the memory controllers, raise or lower the throttling
+    # level, which scales the degree and distance of the prefetcher. When
+    # prefetchers are combined in a MultiPrefetcher, throttle the
+    # MultiPrefetcher, which throttles the prefetchers along.
+    throttle_interval = Param.Unsigned(
+        0, "Prefetches issued per throttling interval, 0 disables throttling"
+    )
+    throttle_levels = Param.Unsigned(
+        5, "Number of throttling levels, the highest one not throttling"
+    )
+    accuracy_high = Param.Float(
+        0.75, "Accuracy from which the prefetcher is accurate"
+    )
+    accuracy_low = Param.Float(
+        0.40, "Accuracy below which the prefetcher is inaccurate"
+    )
+    lateness_threshold = Param.Float(
+        0.01, "Fraction of useful prefetches from which prefetches are late"
+    )
+    pollution_threshold = Param.Float(
+        0.005,
+        "Fraction of demand misses caused by prefetches from which the "
+        "prefetcher pollutes the cache",
+    )
+    pollution_filter_entries = Param.Unsigned(
+        4096, "Entries of the filter of the lines evicted by prefetches"
+    )
+    mem_ctrls = VectorParam.SimObject(
+        [],
+        "Memory controllers (MemCtrl or Ramulator2) whose queue occupancy "
+        "throttles the prefetcher",
+    )
+    mem_occupancy_threshold = Param.Float(
+        0.75, "Memory queue occupancy from which the memory is congested"
+    )
+
     def __init__(self, **kwargs):
         super().__init__(**kwargs)
         self._events = []
@@ -701,7 +739,7 @@ class DiffMatchingPrefetcher(StridePrefetcher):
     type = 'DiffMatchingPrefetcher'
     cxx_class = 'gem5::prefetch::DiffMatching'
     cxx_header = "mem/cache/prefetch/diff_matching.hh"
-    cxx_exports = [PyBindMethod("addPfHelper")]
+    cxx_exports = [PyBindMethod("addPfHelper"), PyBindMethod("addMAAProbe")]
 
     iq_ent_num = Param.Unsigned(16, "Number of entres of iq")
 
@@ -753,6 +791,7 @@ class DiffMatchingPrefetcher(StridePrefetcher):
         self._access_simObj = NULL # Demand init by config
         self._fill_simObj = NULL # Demand init by config
         self._pf_helper = []
+        self._maa_simObj = NULL # Demand init by config
 
     def set_probe_obj(self, monitor_simObj, access_simObj, fill_simObj):
         self._monitor_simObj = monitor_simObj
@@ -764,6 +803,12 @@ class DiffMatchingPrefetcher(StridePrefetcher):
             raise TypeError("argument must be a SimObject type")
         self._pf_helper.append(simObj)
 
+    # Drop the prefetches of the ranges an MAA is serving
+    def set_maa(self, simObj):
+        if not isinstance(simObj, SimObject):
+            raise TypeError("argument must be a SimObject type")
+        self._maa_simObj = simObj
+
     # Override BasePrefetcher::regProbeListeners
     # Register L1 request and response probelisteners
     def regProbeListeners(self):
@@ -775,6 +820,9 @@ class DiffMatchingPrefetcher(StridePrefetcher):
         for pf_helper in self._pf_helper:
             self.getCCObject().addPfHelper(pf_helper.getCCObject())
 
+        # Add MAA ServedRange ProbeListener
+        if self._maa_simObj:
+            self.getCCObject().addMAAProbe(self._maa_simObj.getCCObject())
 
         # Add Trigger ProbeListener
         self.getCCObject().addEventProbe(
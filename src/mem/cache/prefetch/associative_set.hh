@@ -29,9 +29,12 @@
 #ifndef __CACHE_PREFETCH_ASSOCIATIVE_SET_HH__
 #define __CACHE_PREFETCH_ASSOCIATIVE_SET_HH__
 
+#include <string>
+
 #include "mem/cache/replacement_policies/base.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
 #include "mem/cache/tags/tagged_entry.hh"
+#include "sim/serialize.hh"
 
 namespace gem5
 {
@@ -121,6 +124,31 @@ class AssociativeSet
      */
     void invalidate(Entry* entry);
 
+    /**
+     * Checkpoint the valid entries in a section, each one in a section of
+     * its own.
+     *
+     * @param name Name of the section.
+     * @param serialize_entry Called as serialize_entry(cp, entry) to
+     *        checkpoint the fields of an entry besides its tag.
+     */
+    template <class SerializeEntry>
+    void serialize(CheckpointOut &cp, const std::string &name,
+                   SerializeEntry serialize_entry) const;
+
+    /**
+     * Restore the entries checkpointed by serialize into the same slots,
+     * so the container must have the same geometry. The replacement data
+     * of the restored entries is reset as for newly inserted entries.
+     *
+     * @param name Name of the section.
+     * @param unserialize_entry Called as unserialize_entry(cp, entry) to
+     *        restore the fields of an entry besides its tag.
+     */
+    template <class UnserializeEntry>
+    void unserialize(CheckpointIn &cp, const std::string &name,
+                     UnserializeEntry unserialize_entry);
+
     /** Iterator types */
     using const_iterator = typename std::vector<Entry>::const_iterator;
     using iterator = typename std::vector<Entry>::iterator;
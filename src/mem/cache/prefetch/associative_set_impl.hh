@@ -29,6 +29,7 @@
 #ifndef __CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
 #define __CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
 
+#include "base/cprintf.hh"
 #include "base/intmath.hh"
 #include "mem/cache/prefetch/associative_set.hh"
 
@@ -58,7 +59,7 @@ Entry*
 AssociativeSet<Entry>::findEntry(Addr addr, bool is_secure) const
 {
     Addr tag = indexingPolicy->extractTag(addr);
-    const std::vector<ReplaceableEntry*> selected_entries =
+    const std::vector<ReplaceableEntry*> &selected_entries =
         indexingPolicy->getPossibleEntries(addr);
 
     for (const auto& location : selected_entries) {
@@ -83,7 +84,7 @@ Entry*
 AssociativeSet<Entry>::findVictim(Addr addr)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> selected_entries =
+    const std::vector<ReplaceableEntry*> &selected_entries =
         indexingPolicy->getPossibleEntries(addr);
     Entry* victim = static_cast<Entry*>(replacementPolicy->getVictim(
                             selected_entries));
@@ -97,7 +98,7 @@ template<class Entry>
 std::vector<Entry *>
 AssociativeSet<Entry>::getPossibleEntries(const Addr addr) const
 {
-    std::vector<ReplaceableEntry *> selected_entries =
+    const std::vector<ReplaceableEntry *> &selected_entries =
         indexingPolicy->getPossibleEntries(addr);
     std::vector<Entry *> entries(selected_entries.size(), nullptr);
 
@@ -124,6 +125,61 @@ AssociativeSet<Entry>::invalidate(Entry* entry)
     replacementPolicy->invalidate(entry->replacementData);
 }
 
+template<class Entry>
+template<class SerializeEntry>
+void
+AssociativeSet<Entry>::serialize(CheckpointOut &cp, const std::string &name,
+                                 SerializeEntry serialize_entry) const
+{
+    Serializable::ScopedCheckpointSection sec(cp, name);
+
+    std::vector<unsigned> validEntries;
+    for (unsigned idx = 0; idx < numEntries; idx++) {
+        if (entries[idx].isValid())
+            validEntries.push_back(idx);
+    }
+    SERIALIZE_CONTAINER(validEntries);
+
+    for (unsigned idx : validEntries) {
+        Serializable::ScopedCheckpointSection entry_sec(
+            cp, csprintf("entry%d", idx));
+        const Entry &entry = entries[idx];
+        paramOut(cp, "tag", entry.getTag());
+        paramOut(cp, "secure", entry.isSecure());
+        serialize_entry(cp, entry);
+    }
+}
+
+template<class Entry>
+template<class UnserializeEntry>
+void
+AssociativeSet<Entry>::unserialize(CheckpointIn &cp, const std::string &name,
+                                   UnserializeEntry unserialize_entry)
+{
+    Serializable::ScopedCheckpointSection sec(cp, name);
+
+    std::vector<unsigned> validEntries;
+    UNSERIALIZE_CONTAINER(validEntries);
+
+    for (auto &entry : entries)
+        invalidate(&entry);
+
+    for (unsigned idx : validEntries) {
+        fatal_if(idx >= numEntries, "Invalid entry %d in %s", idx,
+                 Serializable::currentSection());
+        Serializable::ScopedCheckpointSection entry_sec(
+            cp, csprintf("entry%d", idx));
+        Entry &entry = entries[idx];
+        Addr tag;
+        bool secure;
+        paramIn(cp, "tag", tag);
+        paramIn(cp, "secure", secure);
+        entry.insert(tag, secure);
+        replacementPolicy->reset(entry.replacementData);
+        unserialize_entry(cp, entry);
+    }
+}
+
 } // namespace gem5
 
 #endif//__CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
@@ -45,7 +45,9 @@
 
 #include "mem/cache/prefetch/base.hh"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 #include "base/intmath.hh"
 #include "mem/cache/base.hh"
@@ -117,7 +119,29 @@ Base::Base(const BasePrefetcherParams &p)
       prefetchOnPfHit(p.prefetch_on_pf_hit),
       useVirtualAddresses(p.use_virtual_addresses),
       prefetchStats(this), issuedPrefetches(0),
-      usefulPrefetches(0), mmu(nullptr) {
+      usefulPrefetches(0),
+      throttleInterval(p.throttle_interval),
+      throttleLevels(p.throttle_levels),
+      accuracyHigh(p.accuracy_high), accuracyLow(p.accuracy_low),
+      latenessThreshold(p.lateness_threshold),
+      pollutionThreshold(p.pollution_threshold),
+      memOccupancyThreshold(p.mem_occupancy_threshold),
+      throttleLevel(p.throttle_levels), aggressiveness(1.0),
+      mmu(nullptr) {
+    fatal_if(throttleLevels == 0, "%s: there must be a throttling level",
+             name());
+    fatal_if(accuracyLow > accuracyHigh, "%s: the low accuracy threshold "
+             "is above the high one", name());
+
+    for (auto *obj : p.mem_ctrls) {
+        auto *mem_ctrl = dynamic_cast<memory::QueueOccupancy *>(obj);
+        fatal_if(!mem_ctrl, "%s: %s does not report its queue occupancy",
+                 name(), obj->name());
+        memCtrls.push_back(mem_ctrl);
+    }
+
+    if (throttleInterval > 0)
+        pollutionFilter.resize(p.pollution_filter_entries);
 }
 
 void Base::setParentInfo(System *sys, ProbeManager *pm, unsigned blk_size) {
@@ -153,7 +177,15 @@ Base::StatGroup::StatGroup(statistics::Group *parent)
       ADD_STAT(pfHitInWB, statistics::units::Count::get(),
                "number of prefetches hit in the Write Buffer"),
       ADD_STAT(pfLate, statistics::units::Count::get(),
-               "number of late prefetches (hitting in cache, MSHR or WB)") {
+               "number of late prefetches (hitting in cache, MSHR or WB)"),
+      ADD_STAT(pfLateDemand, statistics::units::Count::get(),
+               "number of demands hitting in the MSHR of a prefetch"),
+      ADD_STAT(pfPollution, statistics::units::Count::get(),
+               "number of demand misses to lines evicted by prefetches"),
+      ADD_STAT(pfThrottleUp, statistics::units::Count::get(),
+               "number of times the throttling level was raised"),
+      ADD_STAT(pfThrottleDown, statistics::units::Count::get(),
+               "number of times the throttling level was lowered") {
     using namespace statistics;
 
     pfUnused.flags(nozero);
@@ -261,6 +293,7 @@ void Base::prefetchHit(const CacheAccessProbeArg &acc, bool miss) {
     if (has_been_prefetched) {
         usefulPrefetches += 1;
         prefetchStats.pfUseful++;
+        feedback.useful++;
         if (miss) {
             // This case happens when a demand hits on a prefetched line
             // that's not in the requested coherency state.
@@ -269,6 +302,108 @@ void Base::prefetchHit(const CacheAccessProbeArg &acc, bool miss) {
     }
 }
 
+void Base::incrDemandMhsrMisses(Addr blk_addr) {
+    prefetchStats.demandMshrMisses++;
+    feedback.demandMisses++;
+
+    if (!pollutionFilter.empty()) {
+        const size_t index = pollutionFilterIndex(blk_addr);
+        if (pollutionFilter[index]) {
+            pollutionFilter[index] = false;
+            prefetchStats.pfPollution++;
+            feedback.pollutingMisses++;
+        }
+    }
+}
+
+void Base::pfEvictedDemandLine(Addr blk_addr) {
+    if (!pollutionFilter.empty())
+        pollutionFilter[pollutionFilterIndex(blk_addr)] = true;
+}
+
+size_t Base::pollutionFilterIndex(Addr blk_addr) const {
+    const Addr blk_index = blockIndex(blk_addr);
+    return (blk_index ^ (blk_index >> 12)) % pollutionFilter.size();
+}
+
+void Base::prefetchIssued() {
+    prefetchStats.pfIssued++;
+    issuedPrefetches += 1;
+
+    if (throttleInterval == 0)
+        return;
+
+    feedback.issued++;
+    double occupancy = 0;
+    for (const auto *mem_ctrl : memCtrls)
+        occupancy = std::max(occupancy, mem_ctrl->queueOccupancy());
+    feedback.memOccupancy += occupancy;
+
+    if (feedback.issued == throttleInterval) {
+        adjustThrottling();
+        feedback = ThrottleFeedback();
+    }
+}
+
+void Base::adjustThrottling() {
+    const double accuracy = double(feedback.useful) / feedback.issued;
+    const bool late = feedback.useful > 0 &&
+        double(feedback.late) / feedback.useful >= latenessThreshold;
+    const bool polluting = feedback.demandMisses > 0 &&
+        double(feedback.pollutingMisses) / feedback.demandMisses >=
+            pollutionThreshold;
+    const bool congested = !memCtrls.empty() &&
+        feedback.memOccupancy / feedback.issued >= memOccupancyThreshold;
+
+    // Decisions of feedback directed prefetching (Srinath et al., HPCA
+    // 2007): late prefetches call for more aggressiveness, unless they
+    // are inaccurate or polluting, and pollution for less
+    int change = 0;
+    if (accuracy >= accuracyHigh) {
+        if (late)
+            change = 1;
+        else if (polluting)
+            change = -1;
+    } else if (accuracy >= accuracyLow) {
+        if (late && !polluting)
+            change = 1;
+        else if (polluting)
+            change = -1;
+    } else if (late || polluting) {
+        change = -1;
+    }
+
+    // Under memory congestion, prefetches delay the demands, so that only
+    // accurate prefetchers keep their aggressiveness
+    if (congested)
+        change = accuracy >= accuracyHigh ? std::min(change, 0) : -1;
+
+    if (change > 0 && throttleLevel < throttleLevels) {
+        throttleLevel++;
+        prefetchStats.pfThrottleUp++;
+    } else if (change < 0 && throttleLevel > 1) {
+        throttleLevel--;
+        prefetchStats.pfThrottleDown++;
+    } else {
+        return;
+    }
+
+    DPRINTF(HWPrefetch, "Throttling level %d: accuracy %.2f%s%s%s\n",
+            throttleLevel, accuracy, late ? ", late" : "",
+            polluting ? ", polluting" : "", congested ? ", congested" : "");
+    setAggressiveness(double(throttleLevel) / throttleLevels);
+}
+
+unsigned Base::throttledDegree(unsigned degree) const {
+    if (degree == 0)
+        return 0;
+    return std::max(1u, (unsigned)std::ceil(degree * aggressiveness));
+}
+
+unsigned Base::throttledDistance(unsigned distance) const {
+    return throttledDegree(distance);
+}
+
 void Base::regProbeListeners() {
     /**
      * If no probes were added by the configuration scripts, connect to the
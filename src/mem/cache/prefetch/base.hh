@@ -54,6 +54,7 @@
 #include "base/types.hh"
 #include "mem/cache/cache_probe_arg.hh"
 #include "mem/packet.hh"
+#include "mem/queue_occupancy.hh"
 #include "mem/request.hh"
 #include "sim/byteswap.hh"
 #include "sim/clocked_object.hh"
@@ -373,6 +374,18 @@ protected:
         /** The number of times a HW-prefetch is late
          * (hit in cache, MSHR, WB). */
         statistics::Formula pfLate;
+
+        /** The number of demands hitting in the MSHR of a prefetch. */
+        statistics::Scalar pfLateDemand;
+
+        /** The number of demand misses to lines evicted by prefetches. */
+        statistics::Scalar pfPollution;
+
+        /** The number of times the throttling level was raised. */
+        statistics::Scalar pfThrottleUp;
+
+        /** The number of times the throttling level was lowered. */
+        statistics::Scalar pfThrottleDown;
     } prefetchStats;
 
     /** Total prefetches issued */
@@ -380,6 +393,86 @@ protected:
     /** Total prefetches that has been useful */
     uint64_t usefulPrefetches;
 
+    /**
+     * @defgroup PrefetchThrottling Feedback-directed throttling
+     * At the end of every interval, the accuracy, lateness and pollution
+     * of the prefetches, and the queue occupancy of the memory
+     * controllers, raise or lower the throttling level, which scales the
+     * degree and distance of the prefetcher.
+     * @{
+     */
+
+    /** Prefetches issued per throttling interval, 0 if not throttled. */
+    const unsigned throttleInterval;
+
+    /** Number of throttling levels, the highest one not throttling. */
+    const unsigned throttleLevels;
+
+    /** Accuracy from which the prefetcher is accurate. */
+    const double accuracyHigh;
+
+    /** Accuracy below which the prefetcher is inaccurate. */
+    const double accuracyLow;
+
+    /** Fraction of useful prefetches from which prefetches are late. */
+    const double latenessThreshold;
+
+    /**
+     * Fraction of demand misses caused by prefetch evictions from which
+     * the prefetcher pollutes the cache.
+     */
+    const double pollutionThreshold;
+
+    /** Memory queue occupancy from which the memory is congested. */
+    const double memOccupancyThreshold;
+
+    /** Memory controllers whose queue occupancy throttles prefetching. */
+    std::vector<memory::QueueOccupancy *> memCtrls;
+
+    /**
+     * One bit per hashed block address, set when a prefetch evicts a
+     * demand-fetched line and cleared when a demand misses on it.
+     */
+    std::vector<bool> pollutionFilter;
+
+    /** Current throttling level, from 1 to throttleLevels. */
+    unsigned throttleLevel;
+
+    /** Share of its degree and distance the prefetcher uses, in (0, 1]. */
+    double aggressiveness;
+
+    /** Feedback gathered over the current throttling interval. */
+    struct ThrottleFeedback
+    {
+        uint64_t issued = 0;
+        uint64_t useful = 0;
+        uint64_t late = 0;
+        uint64_t demandMisses = 0;
+        uint64_t pollutingMisses = 0;
+        /** Sum of the memory queue occupancies sampled at each issue. */
+        double memOccupancy = 0;
+    } feedback;
+
+    /**
+     * Account for an issued prefetch, and adjust the throttling level at
+     * the end of every interval.
+     */
+    void prefetchIssued();
+
+    /** Adjust the throttling level from the feedback of the interval. */
+    void adjustThrottling();
+
+    /** Get the pollution filter bit of a block address. */
+    size_t pollutionFilterIndex(Addr blk_addr) const;
+
+    /** Scale a number of prefetches by the aggressiveness, keeping one. */
+    unsigned throttledDegree(unsigned degree) const;
+
+    /** Scale a prefetch distance by the aggressiveness, keeping one. */
+    unsigned throttledDistance(unsigned distance) const;
+
+    /** @} */
+
     /** Registered mmu for address translations */
     BaseMMU *mmu;
 
@@ -425,9 +518,32 @@ public:
         prefetchStats.pfUnused++;
     }
 
+    /**
+     * Notify a demand miss allocating an MSHR.
+     * @param blk_addr Block address of the demand.
+     */
+    void incrDemandMhsrMisses(Addr blk_addr);
+
+    /** Notify a demand hitting in the MSHR of a prefetch. */
     void
-    incrDemandMhsrMisses() {
-        prefetchStats.demandMshrMisses++;
+    prefetchLate() {
+        prefetchStats.pfLateDemand++;
+        feedback.late++;
+    }
+
+    /** Notify the eviction of a demand-fetched line by a prefetch. */
+    void pfEvictedDemandLine(Addr blk_addr);
+
+    /** Whether requests of the requestor are prefetches of this object. */
+    virtual bool
+    isPrefetchRequestor(RequestorID id) const {
+        return id == requestorId;
+    }
+
+    /** Set the share of its degree and distance the prefetcher uses. */
+    virtual void
+    setAggressiveness(double _aggressiveness) {
+        aggressiveness = _aggressiveness;
     }
 
     void
@@ -28,14 +28,21 @@ DiffMatching::DiffMatching(const DiffMatchingPrefetcherParams &p)
       indexDataDeltaTable(p.iddt_ent_num, iddt_ent_t(p.iddt_diff_num, false)),
       targetAddrDeltaTable(p.tadt_ent_num, tadt_ent_t(p.tadt_diff_num, false)),
       iddt_ptr(0), tadt_ptr(0),
+      iddtIndex(p.iddt_ent_num), tadtIndex(p.tadt_ent_num),
+      seqMatcher(p.iddt_diff_num, p.tadt_diff_num,
+                 std::vector<unsigned>(std::begin(shift_v), std::end(shift_v))),
+      tadtSeq(p.tadt_diff_num), iddtSeq(p.iddt_diff_num),
       range_unit_param(p.range_unit),
       range_level_param(p.range_level),
       rangeTable(p.rg_ent_num * 4, RangeTableEntry(p.range_unit, p.range_level, false)),
       rg_ptr(0),
+      rgIndex(p.rg_ent_num * 4),
       indexQueue(p.iq_ent_num),
       iq_ptr(0),
+      iqIndex(p.iq_ent_num),
       indirectCandidateScoreboard(p.ics_ent_num, ICSEntry(p.ics_candidate_num, false)),
       ics_ptr(0),
+      icsIndex(p.ics_ent_num),
       checkNewIndexEvent([this] { pickIndexPC(); }, this->name()),
       auto_detect(p.auto_detect),
       detect_period(p.detect_period),
@@ -43,6 +50,8 @@ DiffMatching::DiffMatching(const DiffMatchingPrefetcherParams &p)
       ics_candidate_num(p.ics_candidate_num),
       relationTable(p.rt_ent_num),
       rt_ptr(0),
+      rtIndexPCIndex(p.rt_ent_num),
+      rtTargetPCIndex(p.rt_ent_num),
       statsDMP(this),
       pf_helper(nullptr) {
     /**
@@ -66,6 +75,7 @@ DiffMatching::DiffMatching(const DiffMatchingPrefetcherParams &p)
         if (!p.index_pc_init.empty()) {
             for (auto index_pc : p.index_pc_init) {
                 indexDataDeltaTable[iddt_ptr].update(index_pc, 0, 0).validate();
+                iddtIndex.set(iddt_ptr, index_pc);
                 iddt_ptr++;
             }
             pc_list.insert(
@@ -76,6 +86,7 @@ DiffMatching::DiffMatching(const DiffMatchingPrefetcherParams &p)
         if (!p.target_pc_init.empty()) {
             for (auto target_pc : p.target_pc_init) {
                 targetAddrDeltaTable[tadt_ptr].update(target_pc, 0, 0).validate();
+                tadtIndex.set(tadt_ptr, target_pc);
                 tadt_ptr++;
             }
             pc_list.insert(
@@ -87,6 +98,7 @@ DiffMatching::DiffMatching(const DiffMatchingPrefetcherParams &p)
             for (auto range_pc : p.range_pc_init) {
                 for (unsigned int shift_try : shift_v) {
                     rangeTable[rg_ptr].update(range_pc, 0x0, shift_try, 0).validate();
+                    rgIndex.set(rg_ptr, range_pc);
                     rg_ptr++;
                 }
             }
@@ -102,6 +114,33 @@ DiffMatching::DiffMatching(const DiffMatchingPrefetcherParams &p)
 DiffMatching::~DiffMatching() {
 }
 
+void DiffMatching::PCIndex::set(int slot, Addr pc) {
+    Addr &old_pc = slotPC[slot];
+    if (old_pc == pc)
+        return;
+
+    if (old_pc != MaxAddr) {
+        auto old_slots = slots.find(old_pc);
+        assert(old_slots != slots.end());
+        old_slots->second.erase(std::find(
+            old_slots->second.begin(), old_slots->second.end(), slot));
+        if (old_slots->second.empty())
+            slots.erase(old_slots);
+    }
+
+    // keep slots sorted to preserve the table order
+    auto &new_slots = slots[pc];
+    new_slots.insert(
+        std::lower_bound(new_slots.begin(), new_slots.end(), slot), slot);
+    old_pc = pc;
+}
+
+const std::vector<int> &DiffMatching::PCIndex::find(Addr pc) const {
+    static const std::vector<int> none;
+    auto it = slots.find(pc);
+    return it != slots.end() ? it->second : none;
+}
+
 DiffMatching::DMPStats::DMPStats(statistics::Group *parent)
     : statistics::Group(parent),
       ADD_STAT(dmp_pfIdentified, statistics::units::Count::get(),
@@ -111,7 +150,13 @@ DiffMatching::DMPStats::DMPStats(statistics::Group *parent)
       ADD_STAT(dmp_noValidDataPerPC, statistics::units::Count::get(),
                "number of DMP prefetch candidates identified"),
       ADD_STAT(dmp_dataFill, statistics::units::Count::get(),
-               "number of DMP prefetch candidates identified") {
+               "number of DMP prefetch candidates identified"),
+      ADD_STAT(dmp_maaRangesServed, statistics::units::Count::get(),
+               "number of ranges the MAA notified it serves"),
+      ADD_STAT(dmp_pfSuppressedMAA, statistics::units::Count::get(),
+               "number of DMP prefetch candidates dropped as served by the MAA"),
+      ADD_STAT(dmp_pfSuppressedMAABytes, statistics::units::Byte::get(),
+               "bytes of duplicate prefetch traffic saved by the MAA suppression") {
     using namespace statistics;
 
     int max_per_pc = 32;
@@ -175,12 +220,13 @@ void DiffMatching::pickIndexPC() {
 
 void DiffMatching::matchUpdate(Addr index_pc_in, Addr target_pc_in, ContextID cID_in) {
     // update IndexQueueEntry matched
-    for (auto &iq_ent : indexQueue) {
+    for (int slot : iqIndex.find(index_pc_in)) {
+        auto &iq_ent = indexQueue[slot];
 
         if (!iq_ent.valid)
             continue;
 
-        if (iq_ent.index_pc == index_pc_in && iq_ent.cID == cID_in) {
+        if (iq_ent.cID == cID_in) {
             iq_ent.matched++;
             break;
         }
@@ -235,17 +281,19 @@ void DiffMatching::notifyICSMiss(Addr miss_addr, Addr miss_pc_in, ContextID cID_
 
 void DiffMatching::insertIndexQueue(Addr index_pc_in, ContextID cID_in) {
     // check if already exist
-    for (auto &iq_ent : indexQueue) {
+    for (int slot : iqIndex.find(index_pc_in)) {
+        const auto &iq_ent = indexQueue[slot];
 
         if (!iq_ent.valid)
             continue;
 
-        if (iq_ent.index_pc == index_pc_in && iq_ent.cID == cID_in)
+        if (iq_ent.cID == cID_in)
             return;
     }
 
     // insert to position iq_ptr
     indexQueue[iq_ptr].update(index_pc_in, cID_in).validate();
+    iqIndex.set(iq_ptr, index_pc_in);
     iq_ptr = (iq_ptr + 1) % iq_ent_num;
 
     DPRINTF(DMP, "insert indexQueue: indexPC %llx cID %d\n", index_pc_in, cID_in);
@@ -253,17 +301,19 @@ void DiffMatching::insertIndexQueue(Addr index_pc_in, ContextID cID_in) {
 
 void DiffMatching::insertICS(Addr index_pc_in, ContextID cID_in) {
     // check if already exist
-    for (auto &ics_ent : indirectCandidateScoreboard) {
+    for (int slot : icsIndex.find(index_pc_in)) {
+        const auto &ics_ent = indirectCandidateScoreboard[slot];
 
         if (!ics_ent.valid)
             continue;
 
-        if (ics_ent.index_pc == index_pc_in && ics_ent.cID == cID_in)
+        if (ics_ent.cID == cID_in)
             return;
     }
 
     // insert to position ics_ptr
     indirectCandidateScoreboard[ics_ptr].update(index_pc_in, cID_in).validate();
+    icsIndex.set(ics_ptr, index_pc_in);
     ics_ptr = (ics_ptr + 1) % ics_ent_num;
 
     DPRINTF(DMP, "insert ICS: indexPC %llx cID %d\n", index_pc_in, cID_in);
@@ -271,17 +321,19 @@ void DiffMatching::insertICS(Addr index_pc_in, ContextID cID_in) {
 
 void DiffMatching::insertIDDT(Addr index_pc_in, ContextID cID_in) {
     // check if already exist
-    for (auto &iddt_ent : indexDataDeltaTable) {
+    for (int slot : iddtIndex.find(index_pc_in)) {
+        const auto &iddt_ent = indexDataDeltaTable[slot];
 
         if (!iddt_ent.isValid())
             continue;
 
-        if (iddt_ent.getPC() == index_pc_in && iddt_ent.getContextId() == cID_in)
+        if (iddt_ent.getContextId() == cID_in)
             return;
     }
 
     // insert to position iddt_ptr
     indexDataDeltaTable[iddt_ptr].update(index_pc_in, cID_in).validate();
+    iddtIndex.set(iddt_ptr, index_pc_in);
     iddt_ptr = (iddt_ptr + 1) % iddt_ent_num;
 
     DPRINTF(DMP, "insert IDDT: indexPC %llx cID %d\n", index_pc_in, cID_in);
@@ -289,17 +341,19 @@ void DiffMatching::insertIDDT(Addr index_pc_in, ContextID cID_in) {
 
 void DiffMatching::insertTADT(Addr target_pc_in, ContextID cID_in) {
     // check if already exist
-    for (auto &tadt_ent : targetAddrDeltaTable) {
+    for (int slot : tadtIndex.find(target_pc_in)) {
+        const auto &tadt_ent = targetAddrDeltaTable[slot];
 
         if (!tadt_ent.isValid())
             continue;
 
-        if (tadt_ent.getPC() == target_pc_in && tadt_ent.getContextId() == cID_in)
+        if (tadt_ent.getContextId() == cID_in)
             return;
     }
 
     // insert to position tadt_ptr
     targetAddrDeltaTable[tadt_ptr].update(target_pc_in, cID_in).validate();
+    tadtIndex.set(tadt_ptr, target_pc_in);
     tadt_ptr = (tadt_ptr + 1) % tadt_ent_num;
 
     DPRINTF(DMP, "insert TADT: targetPC %llx cID %d\n", target_pc_in, cID_in);
@@ -307,12 +361,13 @@ void DiffMatching::insertTADT(Addr target_pc_in, ContextID cID_in) {
 
 void DiffMatching::insertRG(Addr req_addr_in, Addr target_pc_in, ContextID cID_in) {
     // check if already exist
-    for (auto &rg_ent : rangeTable) {
+    for (int slot : rgIndex.find(target_pc_in)) {
+        const auto &rg_ent = rangeTable[slot];
 
         if (!rg_ent.valid)
             continue;
 
-        if (rg_ent.target_pc == target_pc_in && rg_ent.cID == cID_in)
+        if (rg_ent.cID == cID_in)
             return;
     }
 
@@ -321,6 +376,7 @@ void DiffMatching::insertRG(Addr req_addr_in, Addr target_pc_in, ContextID cID_i
         rangeTable[rg_ptr].update(
                               target_pc_in, req_addr_in, shift_try, cID_in)
             .validate();
+        rgIndex.set(rg_ptr, target_pc_in);
         rg_ptr = (rg_ptr + 1) % (rg_ent_num * 4);
     }
 
@@ -333,6 +389,9 @@ void DiffMatching::diffMatching(const tadt_ent_t &tadt_ent) {
 
     ContextID tadt_ent_cID = tadt_ent.getContextId();
 
+    tadt_ent.copyTo(tadtSeq.data());
+    seqMatcher.setTarget(tadtSeq.data());
+
     // try to match all valid and ready index data diff-sequence
     for (const auto &iddt_ent : indexDataDeltaTable) {
         if (!iddt_ent.isValid() || !iddt_ent.isReady())
@@ -340,49 +399,34 @@ void DiffMatching::diffMatching(const tadt_ent_t &tadt_ent) {
         if (tadt_ent_cID != iddt_ent.getContextId())
             continue;
 
-        // a specific index data diff-sequence may have multiple matching point
-        for (int i_start = 0; i_start < iddt_diff_num - tadt_diff_num + 1; i_start++) {
-
-            // try different shift values
-            for (unsigned int shift_try : shift_v) {
-                int t_start = 0;
-                while (t_start < tadt_diff_num) {
-                    if (iddt_ent[i_start + t_start] != (tadt_ent[t_start] >> shift_try)) {
-                        break;
-                    }
-                    t_start++;
-                }
-
-                if (t_start == tadt_diff_num) {
-                    // match success
-                    // insert pattern to RelationTable
-                    insertRT(iddt_ent, tadt_ent, i_start + tadt_diff_num, shift_try, tadt_ent_cID);
-
-                    // match updata
-                    matchUpdate(iddt_ent.getPC(), tadt_ent.getPC(), tadt_ent.getContextId());
-                }
-            }
-        }
+        // a specific index data diff-sequence may have multiple matching
+        // point, each of them tried with different shift values
+        iddt_ent.copyTo(iddtSeq.data());
+        seqMatcher.match(iddtSeq.data(),
+            [&](int i_start, unsigned int shift_try) {
+                // match success
+                // insert pattern to RelationTable
+                insertRT(iddt_ent, tadt_ent, i_start + tadt_diff_num, shift_try, tadt_ent_cID);
+
+                // match updata
+                matchUpdate(iddt_ent.getPC(), tadt_ent.getPC(), tadt_ent.getContextId());
+            });
     }
 }
 
 bool DiffMatching::findRTE(Addr index_pc, Addr target_pc, ContextID cID) {
-    for (const auto &rte : relationTable) {
-        if (!rte.valid)
-            continue;
-
-        // only allow one index for each target
-        if (rte.target_pc == target_pc &&
-            rte.cID == cID) {
+    // only allow one index for each target
+    for (int slot : rtTargetPCIndex.find(target_pc)) {
+        const auto &rte = relationTable[slot];
+        if (rte.valid && rte.cID == cID)
             return true;
-        }
+    }
 
-        // avoid ring
-        if (rte.index_pc == target_pc &&
-            rte.target_pc == index_pc &&
-            rte.cID == cID) {
+    // avoid ring
+    for (int slot : rtTargetPCIndex.find(index_pc)) {
+        const auto &rte = relationTable[slot];
+        if (rte.valid && rte.index_pc == target_pc && rte.cID == cID)
             return true;
-        }
     }
     return false;
 }
@@ -390,12 +434,12 @@ bool DiffMatching::findRTE(Addr index_pc, Addr target_pc, ContextID cID) {
 bool DiffMatching::checkRedundantRTE(Addr index_pc, Addr target_base_addr, ContextID cID) {
     // check whether current new RTE will be prefetched by other exist RTEs
     Addr block_addr_mask = ~(Addr(blkSize - 1));
-    for (const auto &rte : relationTable) {
+    for (int slot : rtIndexPCIndex.find(index_pc)) {
+        const auto &rte = relationTable[slot];
         if (!rte.valid)
             continue;
 
-        if (rte.index_pc == index_pc &&
-            ((rte.target_base_addr ^ target_base_addr) & block_addr_mask) == 0 &&
+        if (((rte.target_base_addr ^ target_base_addr) & block_addr_mask) == 0 &&
             rte.cID == cID) {
             // target_base_addr points to the same cache block
             return true;
@@ -459,8 +503,9 @@ void DiffMatching::insertRT(
     if (!new_range_type) {
 
         // check rangeTable for range type
-        for (auto range_ent : rangeTable) {
-            if (range_ent.target_pc != new_index_pc || range_ent.cID != cID)
+        for (int slot : rgIndex.find(new_index_pc)) {
+            const auto &range_ent = rangeTable[slot];
+            if (range_ent.cID != cID)
                 continue;
 
             new_range_type = new_range_type || range_ent.getRangeType();
@@ -495,18 +540,18 @@ void DiffMatching::insertRT(
                              true,
                              priority)
         .validate();
+    rtIndexPCIndex.set(rt_ptr, new_index_pc);
+    rtTargetPCIndex.set(rt_ptr, new_target_pc);
     rt_ptr = (rt_ptr + 1) % rt_ent_num;
 }
 
 int32_t
 DiffMatching::getPriority(Addr pc_in, ContextID cID_in) {
     int32_t priority = 0;
-    for (auto &rt_ent : relationTable) {
+    for (int slot : rtTargetPCIndex.find(pc_in)) {
+        const auto &rt_ent = relationTable[slot];
         // if (!rt_ent.valid()) continue;
 
-        if (rt_ent.target_pc != pc_in)
-            continue;
-
         if (cID_in != -1 && rt_ent.cID != cID_in)
             continue;
 
@@ -567,12 +612,13 @@ bool DiffMatching::RangeTableEntry::getRangeType() const {
 bool DiffMatching::rangeFilter(Addr pc_in, Addr addr_in, ContextID cID_in) {
     bool ret = true;
 
-    for (auto &range_ent : rangeTable) {
+    for (int slot : rgIndex.find(pc_in)) {
+        auto &range_ent = rangeTable[slot];
 
         if (!range_ent.valid)
             continue;
 
-        if (range_ent.target_pc != pc_in || range_ent.cID != cID_in)
+        if (range_ent.cID != cID_in)
             continue;
 
         DPRINTF(DMP, "updateSample: pc %llx addr %llx cur_tail %llx\n",
@@ -602,12 +648,13 @@ void DiffMatching::notifyL1Req(const CacheAccessProbeArg &arg) {
     if (req_addr > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
         return;
 
-    for (auto &tadt_ent : targetAddrDeltaTable) {
+    for (int slot : tadtIndex.find(pkt->req->getPC())) {
+        auto &tadt_ent = targetAddrDeltaTable[slot];
 
         Addr target_pc = tadt_ent.getPC();
 
         // tadt_ent validation check
-        if (target_pc != pkt->req->getPC() || !tadt_ent.isValid())
+        if (!tadt_ent.isValid())
             continue;
 
         // range check
@@ -678,8 +725,9 @@ void DiffMatching::notifyL1Resp(const CacheAccessProbeArg &arg) {
         return;
 
     // update IDDT
-    for (auto &iddt_ent : indexDataDeltaTable) {
-        if (iddt_ent.getPC() == pkt->req->getPC() && iddt_ent.isValid()) {
+    for (int slot : iddtIndex.find(pkt->req->getPC())) {
+        auto &iddt_ent = indexDataDeltaTable[slot];
+        if (iddt_ent.isValid()) {
 
             IndexData new_data;
             std::memcpy(&new_data, &resp_data, sizeof(int64_t));
@@ -743,14 +791,12 @@ void DiffMatching::notifyFill(const CacheAccessProbeArg &arg, const uint8_t *dat
     }
 
     Addr pc = pkt->req->getPC();
-    for (const auto &rt_ent : relationTable) {
+    for (int slot : rtIndexPCIndex.find(pc)) {
+        const auto &rt_ent = relationTable[slot];
 
         if (!rt_ent.valid)
             continue;
 
-        if (rt_ent.index_pc != pc)
-            continue;
-
         /* Assume response data is a int and always occupies 4 bytes */
         const int data_stride = 4;
         const int byte_width = 8;
@@ -759,7 +805,7 @@ void DiffMatching::notifyFill(const CacheAccessProbeArg &arg, const uint8_t *dat
         unsigned range_end;
         unsigned data_offset = pkt->req->getPaddr() & (blkSize - 1);
         if (rt_ent.range) {
-            range_end = std::min(data_offset + data_stride * rt_ent.range_degree, blkSize);
+            range_end = std::min(data_offset + data_stride * throttledDegree(rt_ent.range_degree), blkSize);
         } else {
             range_end = data_offset + data_stride;
         }
@@ -780,10 +826,14 @@ void DiffMatching::notifyFill(const CacheAccessProbeArg &arg, const uint8_t *dat
             //         pc, pkt->getAddr(), data_offset, resp_data, pf_addr);
 
             // insert to missing translation queue
-            insertIndirectPrefetch(pf_addr, rt_ent.target_pc, rt_ent.cID, rt_ent.priority, pkt->getRegion());
+            if (!servedByMAA(pf_addr, rt_ent.target_base_addr, rt_ent.cID))
+                insertIndirectPrefetch(pf_addr, rt_ent.target_pc, rt_ent.cID, rt_ent.priority, pkt->getRegion());
 
             if (rt_ent.target_pc == 0x400ca0) {
-                for (int i = 1; i <= range_ahead_dist; i++) {
+                const int ahead_dist = throttledDistance(range_ahead_dist);
+                for (int i = 1; i <= ahead_dist; i++) {
+                    if (servedByMAA(pf_addr + blkSize * i, rt_ent.target_base_addr, rt_ent.cID))
+                        continue;
                     insertIndirectPrefetch(pf_addr + blkSize * i, rt_ent.target_pc, rt_ent.cID, rt_ent.priority, pkt->getRegion());
                 }
             }
@@ -930,6 +980,48 @@ void DiffMatching::addPfHelper(Stride *s) {
     pf_helper = s;
 }
 
+void DiffMatching::MAAListener::notify(const MAAServedRange &range) {
+    parent.notifyMAARange(range);
+}
+
+void DiffMatching::addMAAProbe(SimObject *maa) {
+    ProbeManager *pm(maa->getProbeManager());
+    maaListeners.push_back(new MAAListener(*this, pm, "ServedRange"));
+}
+
+void DiffMatching::notifyMAARange(const MAAServedRange &range) {
+    auto it = std::find_if(maaServed.begin(), maaServed.end(),
+        [&range](const MAAServedRange &served) {
+            return served.indirect == range.indirect && served.unit == range.unit;
+        });
+
+    if (range.active) {
+        DPRINTF(DMP, "MAA serves %s base %llx [%llx, %llx) cID %d\n",
+                range.indirect ? "indirect" : "stream",
+                range.base, range.start, range.end, range.cid);
+        statsDMP.dmp_maaRangesServed++;
+        if (it != maaServed.end())
+            *it = range;
+        else
+            maaServed.push_back(range);
+    } else if (it != maaServed.end()) {
+        maaServed.erase(it);
+    }
+}
+
+bool DiffMatching::servedByMAA(Addr pf_addr, Addr target_base_addr, ContextID cID) {
+    for (const auto &served : maaServed) {
+        if (served.cid != cID)
+            continue;
+        if (served.indirect ? served.base == target_base_addr : served.contains(pf_addr)) {
+            statsDMP.dmp_pfSuppressedMAA++;
+            statsDMP.dmp_pfSuppressedMAABytes += blkSize;
+            return true;
+        }
+    }
+    return false;
+}
+
 void DiffMatching::calculatePrefetch(const PrefetchInfo &pfi,
                                      std::vector<AddrPriority> &addresses,
                                      const CacheAccessor &cache) {
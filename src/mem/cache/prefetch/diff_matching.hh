@@ -10,6 +10,8 @@
 #include <unordered_map>
 
 #include "base/types.hh"
+#include "mem/MAA/ServedRange.hh"
+#include "mem/cache/prefetch/diff_seq_matcher.hh"
 #include "mem/cache/prefetch/stride.hh"
 #include "mem/cache/prefetch/queued.hh"
 #include "sim/eventq.hh"
@@ -49,6 +51,27 @@ class DiffMatching : public Stride {
     const int iddt_diff_num;
     const int tadt_diff_num;
 
+    /**
+     * Index of the slots of a table by PC. Lookups visit the slots holding
+     * a PC in table order, so they see the same entries in the same order
+     * as a scan of the whole table.
+     */
+    class PCIndex {
+        std::unordered_map<Addr, std::vector<int>> slots;
+
+        // PC held by every slot, MaxAddr if the slot was never set
+        std::vector<Addr> slotPC;
+
+    public:
+        PCIndex(int size) : slotPC(size, MaxAddr) {};
+
+        // record that a slot now holds an entry of the given PC
+        void set(int slot, Addr pc);
+
+        // slots holding entries of the given PC, in table order
+        const std::vector<int> &find(Addr pc) const;
+    };
+
     template <typename T>
     class DiffSeqCollection {
         Addr pc;
@@ -113,6 +136,13 @@ class DiffMatching : public Stride {
 
         T operator[](int index) const { return diff[(diff_ptr + index) % diff_size]; };
 
+        // copy the diff-sequence, oldest first, to out
+        void copyTo(T *out) const {
+            std::copy(diff.begin() + diff_ptr, diff.end(), out);
+            std::copy(diff.begin(), diff.begin() + diff_ptr,
+                      out + (diff.size() - diff_ptr));
+        };
+
         DiffSeqCollection &update(Addr pc_new, ContextID cID_new, T last_new = 0) {
             pc = pc_new;
             last = last_new;
@@ -134,6 +164,14 @@ class DiffMatching : public Stride {
     int iddt_ptr;
     int tadt_ptr;
 
+    PCIndex iddtIndex;
+    PCIndex tadtIndex;
+
+    // matcher of TADT diff-sequences against IDDT diff-sequences
+    DiffSeqMatcher seqMatcher;
+    std::vector<TargetAddr> tadtSeq;
+    std::vector<IndexData> iddtSeq;
+
     void insertIDDT(Addr index_pc_in, ContextID cID_in);
     void insertTADT(Addr target_pc_in, ContextID cID_in);
 
@@ -215,6 +253,8 @@ class DiffMatching : public Stride {
 
     int rg_ptr;
 
+    PCIndex rgIndex;
+
     void insertRG(Addr req_addr_in, Addr target_pc_in, ContextID cID_in);
 
     bool rangeFilter(Addr pc_in, Addr addr_in, ContextID cID_in);
@@ -256,6 +296,8 @@ class DiffMatching : public Stride {
 
     int iq_ptr;
 
+    PCIndex iqIndex;
+
     // TODO: insert from Stride Hit
     void insertIndexQueue(Addr index_pc, ContextID cID_in);
 
@@ -299,6 +341,8 @@ class DiffMatching : public Stride {
 
     int ics_ptr;
 
+    PCIndex icsIndex;
+
     void notifyICSMiss(Addr miss_addr, Addr miss_pc_in, ContextID cID_in);
 
     void insertICS(Addr index_pc_in, ContextID cID_in);
@@ -369,6 +413,10 @@ class DiffMatching : public Stride {
     // point to the next update position
     int rt_ptr;
 
+    // RelationTable slots by index pc and by target pc
+    PCIndex rtIndexPCIndex;
+    PCIndex rtTargetPCIndex;
+
     bool findRTE(Addr index_pc, Addr target_pc, ContextID cID);
 
     bool checkRedundantRTE(Addr index_pc, Addr target_base_addr, ContextID cID);
@@ -390,6 +438,9 @@ class DiffMatching : public Stride {
         statistics::Scalar dmp_noValidData;
         statistics::Vector dmp_noValidDataPerPC;
         statistics::Scalar dmp_dataFill;
+        statistics::Scalar dmp_maaRangesServed;
+        statistics::Scalar dmp_pfSuppressedMAA;
+        statistics::Scalar dmp_pfSuppressedMAABytes;
     } statsDMP;
 
     std::vector<Addr> dmp_stats_pc;
@@ -397,6 +448,33 @@ class DiffMatching : public Stride {
     // A StridePrefetcher which helps DMP detection.
     Stride *pf_helper;
 
+    /**
+     * Probe listener of the ranges the MAA is serving. While an MAA
+     * stream instruction covers a prefetch address, or an MAA indirect
+     * instruction targets the base of a relation, the prefetches would
+     * duplicate the MAA accesses and are dropped.
+     */
+    class MAAListener : public ProbeListenerArgBase<MAAServedRange> {
+    public:
+        MAAListener(DiffMatching &_parent, ProbeManager *pm,
+                    const std::string &name)
+            : ProbeListenerArgBase(pm, name), parent(_parent) {}
+        void notify(const MAAServedRange &range) override;
+
+    protected:
+        DiffMatching &parent;
+    };
+
+    std::vector<MAAListener *> maaListeners;
+
+    // ranges currently served by the MAA
+    std::vector<MAAServedRange> maaServed;
+
+    void notifyMAARange(const MAAServedRange &range);
+
+    // whether the MAA already serves a prefetch of the relation
+    bool servedByMAA(Addr pf_addr, Addr target_base_addr, ContextID cID);
+
     /** DMP functions */
 
 protected:
@@ -425,6 +503,9 @@ public:
 
     void addPfHelper(Stride *s);
 
+    // Listen to the ServedRange probe of an MAA
+    void addMAAProbe(SimObject *maa);
+
     void calculatePrefetch(const PrefetchInfo &pfi,
                            std::vector<AddrPriority> &addresses,
                            const CacheAccessor &cache) override;
@@ -0,0 +1,32 @@
+#include "mem/cache/prefetch/diff_seq_matcher.hh"
+
+namespace gem5 {
+
+namespace prefetch {
+
+DiffSeqMatcher::DiffSeqMatcher(int index_len, int target_len,
+                               const std::vector<unsigned> &shifts)
+    : targetLen(target_len),
+      numWindows(index_len - target_len + 1),
+      shifts(shifts),
+      basePow(1),
+      shiftedTargets(shifts.size() * target_len),
+      targetHashes(shifts.size()) {
+    for (int i = 1; i < targetLen; ++i)
+        basePow *= base;
+}
+
+void DiffSeqMatcher::setTarget(const int64_t *target) {
+    for (size_t s = 0; s < shifts.size(); ++s) {
+        int64_t *shifted = &shiftedTargets[s * targetLen];
+        uint64_t hash = 0;
+        for (int i = 0; i < targetLen; ++i) {
+            shifted[i] = target[i] >> shifts[s];
+            hash = hash * base + static_cast<uint64_t>(shifted[i]);
+        }
+        targetHashes[s] = hash;
+    }
+}
+
+} // namespace prefetch
+} // namespace gem5
@@ -0,0 +1,102 @@
+/**
+* Difference sequence matcher of the difference-based prefetcher
+*/
+
+#ifndef __MEM_CACHE_PREFETCH_DIFF_SEQ_MATCHER_HH__
+#define __MEM_CACHE_PREFETCH_DIFF_SEQ_MATCHER_HH__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace gem5 {
+
+namespace prefetch {
+
+/**
+ * Finds where a target address difference sequence, shifted right by one
+ * of a set of shift values, appears in an index data difference sequence.
+ *
+ * The target is loaded once and can then be matched against many index
+ * sequences. Every window of the index sequence is compared through a
+ * rolling hash against the hash of each shifted target, and only windows
+ * whose hash matches are compared element by element. The matches are
+ * therefore exactly those of the naive comparison of every window with
+ * every shift, and they are reported in the same order: by window start
+ * first, then by shift in the order the shifts were given.
+ */
+class DiffSeqMatcher
+{
+  public:
+    /**
+     * @param index_len Length of the index data difference sequences.
+     * @param target_len Length of the target address difference sequences.
+     * @param shifts Shift values to try, in matching order.
+     */
+    DiffSeqMatcher(int index_len, int target_len,
+                   const std::vector<unsigned> &shifts);
+
+    /**
+     * Load the target sequence the next index sequences are matched
+     * against.
+     *
+     * @param target target_len differences, oldest first.
+     */
+    void setTarget(const int64_t *target);
+
+    /**
+     * Match an index sequence against the loaded target.
+     *
+     * @param index index_len differences, oldest first.
+     * @param on_match Called as on_match(start, shift) for every match,
+     *        where start is the window start in the index sequence.
+     */
+    template <typename OnMatch>
+    void
+    match(const int64_t *index, OnMatch &&on_match) const
+    {
+        if (numWindows <= 0)
+            return;
+
+        uint64_t hash = 0;
+        for (int i = 0; i < targetLen; ++i)
+            hash = hash * base + static_cast<uint64_t>(index[i]);
+
+        for (int start = 0; ; ++start) {
+            const int64_t *window = index + start;
+            for (size_t s = 0; s < shifts.size(); ++s) {
+                const int64_t *target = &shiftedTargets[s * targetLen];
+                if (hash == targetHashes[s] &&
+                    std::equal(window, window + targetLen, target)) {
+                    on_match(start, shifts[s]);
+                }
+            }
+
+            if (start + 1 == numWindows)
+                break;
+
+            hash = (hash - static_cast<uint64_t>(index[start]) * basePow) *
+                base + static_cast<uint64_t>(index[start + targetLen]);
+        }
+    }
+
+  protected:
+    /** Multiplier of the polynomial hash, arithmetic is modulo 2^64. */
+    static constexpr uint64_t base = 0x100000001b3ULL;
+
+    const int targetLen;
+    const int numWindows;
+    const std::vector<unsigned> shifts;
+
+    /** base^(targetLen - 1), weight of the oldest element of a window. */
+    uint64_t basePow;
+
+    /** The target shifted by every shift value, one after the other. */
+    std::vector<int64_t> shiftedTargets;
+    std::vector<uint64_t> targetHashes;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif // __MEM_CACHE_PREFETCH_DIFF_SEQ_MATCHER_HH__
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "mem/cache/prefetch/diff_seq_matcher.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const std::vector<unsigned> shifts = {0, 1, 2, 3};
+
+typedef std::vector<std::tuple<int, unsigned>> Matches;
+
+/** The window-by-window comparison the matcher must reproduce. */
+Matches
+naiveMatch(const std::vector<int64_t> &index,
+           const std::vector<int64_t> &target)
+{
+    Matches matches;
+    const int index_len = index.size();
+    const int target_len = target.size();
+    for (int start = 0; start < index_len - target_len + 1; start++) {
+        for (unsigned shift : shifts) {
+            int t = 0;
+            while (t < target_len) {
+                if (index[start + t] != (target[t] >> shift))
+                    break;
+                t++;
+            }
+            if (t == target_len)
+                matches.emplace_back(start, shift);
+        }
+    }
+    return matches;
+}
+
+Matches
+hashMatch(prefetch::DiffSeqMatcher &matcher,
+          const std::vector<int64_t> &index,
+          const std::vector<int64_t> &target)
+{
+    Matches matches;
+    matcher.setTarget(target.data());
+    matcher.match(index.data(), [&matches](int start, unsigned shift) {
+        matches.emplace_back(start, shift);
+    });
+    return matches;
+}
+
+/**
+ * Build the index and target difference sequences of an A[B[i]] stream,
+ * where B holds random indices and A has elements of 1 << elem_shift
+ * bytes, with noise injected in the target stream.
+ */
+void
+indirectStream(std::mt19937_64 &rng, int index_len, int target_len,
+               int elem_shift, std::vector<int64_t> &index,
+               std::vector<int64_t> &target)
+{
+    std::uniform_int_distribution<int64_t> data(0, 64);
+    std::uniform_int_distribution<int> noise(0, 7);
+    index.resize(index_len);
+    for (auto &d : index)
+        d = data(rng) - 32;
+
+    // The target stream follows the last target_len index differences
+    target.resize(target_len);
+    for (int i = 0; i < target_len; i++) {
+        target[i] = index[index_len - target_len + i] << elem_shift;
+        if (noise(rng) == 0)
+            target[i] += 1;
+    }
+}
+
+} // anonymous namespace
+
+/** Sequences built to match at every window with several shifts. */
+TEST(DiffSeqMatcherTest, ConstantSequences)
+{
+    prefetch::DiffSeqMatcher matcher(12, 10, shifts);
+    std::vector<int64_t> index(12, 0);
+    std::vector<int64_t> target(10, 0);
+    EXPECT_EQ(hashMatch(matcher, index, target), naiveMatch(index, target));
+    EXPECT_EQ(hashMatch(matcher, index, target).size(), 3 * shifts.size());
+
+    std::fill(index.begin(), index.end(), 1);
+    std::fill(target.begin(), target.end(), 4);
+    EXPECT_EQ(hashMatch(matcher, index, target), naiveMatch(index, target));
+    EXPECT_EQ(hashMatch(matcher, index, target),
+              Matches({{0, 2}, {1, 2}, {2, 2}}));
+}
+
+/** Negative differences must shift arithmetically, like the naive match. */
+TEST(DiffSeqMatcherTest, NegativeDifferences)
+{
+    prefetch::DiffSeqMatcher matcher(4, 2, shifts);
+    std::vector<int64_t> index = {-1, -1, -2, 5};
+    std::vector<int64_t> target = {-7, -8};
+    EXPECT_EQ(hashMatch(matcher, index, target), naiveMatch(index, target));
+    EXPECT_EQ(hashMatch(matcher, index, target),
+              Matches({{0, 3}}));
+}
+
+/** A target longer than the index sequence never matches. */
+TEST(DiffSeqMatcherTest, NoWindow)
+{
+    prefetch::DiffSeqMatcher matcher(4, 6, shifts);
+    std::vector<int64_t> index(4, 0);
+    std::vector<int64_t> target(6, 0);
+    EXPECT_TRUE(hashMatch(matcher, index, target).empty());
+}
+
+/** Random indirect streams of several table geometries. */
+TEST(DiffSeqMatcherTest, IndirectStreams)
+{
+    std::mt19937_64 rng(0x5eed);
+    const std::vector<std::tuple<int, int>> geometries = {
+        {12, 10}, {16, 8}, {32, 4}, {64, 16}, {10, 10},
+    };
+
+    for (const auto &[index_len, target_len] : geometries) {
+        prefetch::DiffSeqMatcher matcher(index_len, target_len, shifts);
+        for (int run = 0; run < 2000; run++) {
+            std::vector<int64_t> index, target;
+            indirectStream(rng, index_len, target_len, run % 4, index,
+                           target);
+            ASSERT_EQ(hashMatch(matcher, index, target),
+                      naiveMatch(index, target))
+                << "index_len " << index_len << " target_len "
+                << target_len << " run " << run;
+        }
+    }
+}
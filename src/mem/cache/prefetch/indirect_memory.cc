@@ -142,7 +142,8 @@ IndirectMemory::calculatePrefetch(const PrefetchInfo &pfi,
 
                         // If the counter is high enough, start prefetching
                         if (pt_entry->indirectCounter > prefetchThreshold) {
-                            unsigned distance = maxPrefetchDistance *
+                            unsigned distance =
+                                throttledDistance(maxPrefetchDistance) *
                                 pt_entry->indirectCounter.calcSaturation();
                             for (int delta = 1; delta < distance; delta += 1) {
                                 Addr pf_addr = pt_entry->baseAddr +
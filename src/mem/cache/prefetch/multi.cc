@@ -70,6 +70,24 @@ Multi::nextPrefetchReadyTime() const
     return next_ready;
 }
 
+bool
+Multi::isPrefetchRequestor(RequestorID id) const
+{
+    for (auto pf : prefetchers) {
+        if (pf->isPrefetchRequestor(id))
+            return true;
+    }
+    return false;
+}
+
+void
+Multi::setAggressiveness(double _aggressiveness)
+{
+    Base::setAggressiveness(_aggressiveness);
+    for (auto pf : prefetchers)
+        pf->setAggressiveness(_aggressiveness);
+}
+
 PacketPtr
 Multi::getPacket()
 {
@@ -80,8 +98,7 @@ Multi::getPacket()
         if (prefetchers[pf_turn]->nextPrefetchReadyTime() <= curTick()) {
             PacketPtr pkt = prefetchers[pf_turn]->getPacket();
             panic_if(!pkt, "Prefetcher is ready but didn't return a packet.");
-            prefetchStats.pfIssued++;
-            issuedPrefetches++;
+            prefetchIssued();
             return pkt;
         }
         pf_turn = (pf_turn + 1) % prefetchers.size();
@@ -61,6 +61,11 @@ class Multi : public Base
     PacketPtr getPacket() override;
     Tick nextPrefetchReadyTime() const override;
 
+    bool isPrefetchRequestor(RequestorID id) const override;
+
+    /** The sub-prefetchers are throttled along. */
+    void setAggressiveness(double _aggressiveness) override;
+
     /** @{ */
     /**
      * Ignore notifications since each sub-prefetcher already gets a
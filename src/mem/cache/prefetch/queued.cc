@@ -198,8 +198,10 @@ void Queued::notify(const CacheAccessProbeArg &acc, const PrefetchInfo &pfi) {
     std::vector<AddrPriority> addresses;
     calculatePrefetch(pfi, addresses, cache);
 
-    // Get the maximu number of prefetches that we are allowed to generate
-    size_t max_pfs = getMaxPermittedPrefetches(addresses.size());
+    // Get the maximu number of prefetches that we are allowed to generate,
+    // scaled down when the prefetcher is throttled
+    size_t max_pfs = throttledDegree(
+        getMaxPermittedPrefetches(addresses.size()));
 
     // Queue up generated prefetches
     size_t num_pfs = 0;
@@ -253,8 +255,7 @@ Queued::getPacket() {
     PacketPtr pkt = pfq.front().pkt;
     pfq.pop_front();
 
-    prefetchStats.pfIssued++;
-    issuedPrefetches += 1;
+    prefetchIssued();
     assert(pkt != nullptr);
     DPRINTF(HWPrefetch, "Generating prefetch for %#x.\n", pkt->getAddr());
 
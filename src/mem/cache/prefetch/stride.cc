@@ -48,6 +48,7 @@
 
 #include <cassert>
 
+#include "base/cprintf.hh"
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/random.hh"
@@ -201,6 +202,42 @@ void Stride::calculatePrefetch(const PrefetchInfo &pfi,
     }
 }
 
+void Stride::serialize(CheckpointOut &cp) const {
+    std::vector<int> contexts;
+    for (const auto &table : pcTables)
+        contexts.push_back(table.first);
+    SERIALIZE_CONTAINER(contexts);
+
+    for (const auto &table : pcTables) {
+        table.second.serialize(cp, csprintf("pcTable%d", table.first),
+            [](CheckpointOut &cp, const StrideEntry &entry) {
+                paramOut(cp, "lastAddr", entry.lastAddr);
+                paramOut(cp, "stride", entry.stride);
+                paramOut(cp, "confidence", uint8_t(entry.confidence));
+            });
+    }
+}
+
+void Stride::unserialize(CheckpointIn &cp) {
+    // Checkpoints without prefetcher state leave the tables cold
+    if (!cp.entryExists(Serializable::currentSection(), "contexts"))
+        return;
+
+    std::vector<int> contexts;
+    UNSERIALIZE_CONTAINER(contexts);
+
+    for (int context : contexts) {
+        findTable(context)->unserialize(cp, csprintf("pcTable%d", context),
+            [](CheckpointIn &cp, StrideEntry &entry) {
+                uint8_t confidence;
+                paramIn(cp, "lastAddr", entry.lastAddr);
+                paramIn(cp, "stride", entry.stride);
+                paramIn(cp, "confidence", confidence);
+                entry.confidence.set(confidence);
+            });
+    }
+}
+
 uint32_t
 StridePrefetcherHashedSetAssociative::extractSet(const Addr pc) const {
     const Addr hash1 = pc >> 1;
@@ -103,6 +103,12 @@ class Base : public SimObject
     virtual ReplaceableEntry* getVictim(
                            const ReplacementCandidates& candidates) const = 0;
 
+    /**
+     * Whether getVictim() relies on being given all the entries of a set,
+     * in which case the candidates must not be filtered beforehand.
+     */
+    virtual bool needsAllCandidates() const { return false; }
+
     /**
      * Instantiate a replacement data entry.
      *
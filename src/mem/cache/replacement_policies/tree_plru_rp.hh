@@ -196,6 +196,9 @@ class TreePLRU : public Base
     ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
                                                                      override;
 
+    /** The victim is found by walking the tree of the whole set. */
+    bool needsAllCandidates() const override { return true; }
+
     /**
      * Instantiate a replacement data entry. Consecutive calls to this
      * function use the same tree up to numLeaves. When numLeaves replacement
@@ -35,6 +35,7 @@
 
 from m5.objects.ClockedObject import ClockedObject
 from m5.objects.IndexingPolicies import *
+from m5.objects.PartitioningPolicies import *
 from m5.params import *
 from m5.proxy import *
 
@@ -80,6 +81,11 @@ class BaseTags(ClockedObject):
         Parent.cache_line_size, "Indexing entry size in bytes"
     )
 
+    # Partition the lines by memory region or requestor
+    partition_manager = Param.PartitionManager(
+        NULL, "Partitions the cache lines, if set"
+    )
+
 
 class BaseSetAssoc(BaseTags):
     type = "BaseSetAssoc"
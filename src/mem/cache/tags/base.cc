@@ -64,6 +64,7 @@ BaseTags::BaseTags(const Params &p)
       warmupBound((p.warmup_percentage / 100.0) * (p.size / p.block_size)),
       warmedUp(false), numBlocks(p.size / p.block_size),
       dataBlks(new uint8_t[p.size]), // Allocate data storage in one big chunk
+      partitionManager(p.partition_manager),
       stats(*this) {
     registerExitCallback([this]() { cleanupRefs(); });
 }
@@ -79,7 +80,7 @@ BaseTags::findBlock(Addr addr, bool is_secure) const {
     Addr tag = extractTag(addr);
 
     // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry *> entries =
+    const std::vector<ReplaceableEntry *> &entries =
         indexingPolicy->getPossibleEntries(addr);
 
     // Search for block
@@ -109,6 +110,9 @@ void BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk) {
     blk->insert(extractTag(pkt->getAddr()), pkt->isSecure(), requestor_id, pkt->req->taskId());
     blk->setRegion(pkt->req->getRegion());
 
+    if (partitionManager)
+        partitionManager->notifyAcquire(partitionManager->partitionId(blk));
+
     // Check if cache warm up is done
     if (!warmedUp && stats.tagsInUse.value() >= warmupBound) {
         warmedUp = true;
@@ -131,6 +135,39 @@ void BaseTags::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk) {
     assert(!src_blk->isValid());
 }
 
+std::optional<uint64_t>
+BaseTags::entryPartition(const ReplaceableEntry *entry) const {
+    const CacheBlk *blk = static_cast<const CacheBlk *>(entry);
+    if (!blk->isValid())
+        return std::nullopt;
+    return partitionManager->partitionId(blk);
+}
+
+const std::vector<ReplaceableEntry *> &
+BaseTags::partitionCandidates(const std::vector<ReplaceableEntry *> &entries,
+                              uint64_t partition_id) {
+    if (!partitionManager)
+        return entries;
+
+    partitionedEntries = entries;
+    partitionManager->filterByPartition(partitionedEntries, partition_id,
+        [this](const ReplaceableEntry *entry) {
+            return entryPartition(entry);
+        });
+    return partitionedEntries;
+}
+
+bool BaseTags::partitionAllowsCoAllocation(ReplaceableEntry *entry,
+                                           uint64_t partition_id) {
+    if (!partitionManager)
+        return true;
+
+    return partitionManager->allowCoAllocation(entry, partition_id,
+        [this](const ReplaceableEntry *entry) {
+            return entryPartition(entry);
+        });
+}
+
 Addr BaseTags::extractTag(const Addr addr) const {
     return indexingPolicy->extractTag(addr);
 }
@@ -49,13 +49,16 @@
 #include <cassert>
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "base/callback.hh"
 #include "base/logging.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/cache/cache_blk.hh"
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
 #include "mem/packet.hh"
 #include "params/BaseTags.hh"
 #include "sim/clocked_object.hh"
@@ -102,6 +105,45 @@ class BaseTags : public ClockedObject
     /** The data blocks, 1 per cache block. */
     std::unique_ptr<uint8_t[]> dataBlks;
 
+    /** Partitions the lines of the cache, if set. */
+    partitioning_policy::PartitionManager *partitionManager;
+
+    /** Candidates left by the last partitioning of the candidates. */
+    std::vector<ReplaceableEntry *> partitionedEntries;
+
+    /**
+     * Get the partition of the line held by a replacement candidate.
+     *
+     * @param entry The replacement candidate.
+     * @return The partition, or nothing if the candidate is invalid.
+     */
+    virtual std::optional<uint64_t>
+    entryPartition(const ReplaceableEntry *entry) const;
+
+    /**
+     * Get the replacement candidates a partition may pick its victim
+     * from. Without a partition manager, all the candidates are returned.
+     * The list may be empty, in which case no line must be allocated.
+     *
+     * @param entries All the replacement candidates.
+     * @param partition_id Partition of the line to allocate.
+     * @return The candidates allowed to the partition.
+     */
+    const std::vector<ReplaceableEntry *> &
+    partitionCandidates(const std::vector<ReplaceableEntry *> &entries,
+                        uint64_t partition_id);
+
+    /**
+     * Check whether a partition may allocate a line in an entry that is
+     * already present, without evicting any line. Always true without a
+     * partition manager.
+     *
+     * @param entry The entry the line is allocated in.
+     * @param partition_id Partition of the line to allocate.
+     */
+    bool partitionAllowsCoAllocation(ReplaceableEntry *entry,
+                                     uint64_t partition_id);
+
     /**
      * TODO: It would be good if these stats were acquired after warmup.
      */
@@ -189,6 +231,29 @@ class BaseTags : public ClockedObject
      */
     std::string print();
 
+    /** Number of blocks of the tags. */
+    unsigned getNumBlocks() const { return numBlocks; }
+
+    /**
+     * Get the partition a packet allocates its line in, 0 if the cache is
+     * not partitioned.
+     */
+    uint64_t
+    partitionId(const PacketPtr pkt) const
+    {
+        return partitionManager ? partitionManager->partitionId(pkt) : 0;
+    }
+
+    /**
+     * Get the partition of a valid cache line, 0 if the cache is not
+     * partitioned.
+     */
+    uint64_t
+    partitionId(const CacheBlk *blk) const
+    {
+        return partitionManager ? partitionManager->partitionId(blk) : 0;
+    }
+
     /**
      * Finds the block in the cache without touching it.
      *
@@ -260,6 +325,9 @@ class BaseTags : public ClockedObject
         stats.totalRefs += blk->getRefCount();
         stats.sampledRefs++;
 
+        if (partitionManager)
+            partitionManager->notifyRelease(partitionManager->partitionId(blk));
+
         blk->invalidate();
     }
 
@@ -276,11 +344,13 @@ class BaseTags : public ClockedObject
      * @param is_secure True if the target memory space is secure.
      * @param size Size, in bits, of new block to allocate.
      * @param evict_blks Cache blocks to be evicted.
-     * @return Cache block to be replaced.
+     * @param partition_id Partition of the new block.
+     * @return Cache block to be replaced, nullptr if there is none.
      */
     virtual CacheBlk* findVictim(Addr addr, const bool is_secure,
                                  const std::size_t size,
-                                 std::vector<CacheBlk*>& evict_blks) = 0;
+                                 std::vector<CacheBlk*>& evict_blks,
+                                 uint64_t partition_id) = 0;
 
     /**
      * Access block and update replacement data. May not succeed, in which case
@@ -45,6 +45,7 @@
 
 #include "mem/cache/tags/base_set_assoc.hh"
 
+#include <optional>
 #include <string>
 
 #include "base/intmath.hh"
@@ -55,7 +56,8 @@ namespace gem5
 BaseSetAssoc::BaseSetAssoc(const Params &p)
     :BaseTags(p), allocAssoc(p.assoc), blks(p.size / p.block_size),
      sequentialAccess(p.sequential_access),
-     replacementPolicy(p.replacement_policy)
+     replacementPolicy(p.replacement_policy), assoc(p.assoc),
+     tagKeys(blks.size(), invalidTagKey)
 {
     // There must be a indexing policy
     fatal_if(!p.indexing_policy, "An indexing policy is required");
@@ -64,6 +66,9 @@ BaseSetAssoc::BaseSetAssoc(const Params &p)
     if (blkSize < 4 || !isPowerOf2(blkSize)) {
         fatal("Block size must be at least 4 and a power of 2");
     }
+    fatal_if(partitionManager && replacementPolicy->needsAllCandidates(),
+             "%s: the replacement policy needs all the lines of a set, and "
+             "cannot be used with a partition manager", name());
 }
 
 void
@@ -89,6 +94,7 @@ void
 BaseSetAssoc::invalidate(CacheBlk *blk)
 {
     BaseTags::invalidate(blk);
+    updateTagKey(blk);
 
     // Decrease the number of tags in use
     stats.tagsInUse--;
@@ -101,6 +107,8 @@ void
 BaseSetAssoc::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
     BaseTags::moveBlock(src_blk, dest_blk);
+    updateTagKey(src_blk);
+    updateTagKey(dest_blk);
 
     // Since the blocks were using different replacement data pointers,
     // we must touch the replacement data of the new entry, and invalidate
@@ -109,4 +117,40 @@ BaseSetAssoc::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
     replacementPolicy->reset(dest_blk->replacementData);
 }
 
+void
+BaseSetAssoc::updateTagKey(const CacheBlk *blk)
+{
+    tagKeys[blk->getSet() * assoc + blk->getWay()] = blk->isValid() ?
+        tagKey(blk->getTag(), blk->isSecure()) : invalidTagKey;
+}
+
+CacheBlk*
+BaseSetAssoc::findBlock(Addr addr, bool is_secure) const
+{
+    const std::optional<uint32_t> set = indexingPolicy->getSet(addr);
+    if (!set) {
+        return BaseTags::findBlock(addr, is_secure);
+    }
+
+    // Compare all the ways of the set without an early exit, so that the
+    // compiler can vectorize the loop
+    const Addr key = tagKey(extractTag(addr), is_secure);
+    const Addr *keys = &tagKeys[*set * assoc];
+    unsigned match = assoc;
+    for (unsigned way = 0; way < assoc; ++way) {
+        if (keys[way] == key) {
+            match = way;
+        }
+    }
+
+    if (match == assoc) {
+        return nullptr;
+    }
+
+    CacheBlk *blk =
+        static_cast<CacheBlk*>(indexingPolicy->getEntry(*set, match));
+    assert(blk->matchTag(extractTag(addr), is_secure));
+    return blk;
+}
+
 } // namespace gem5
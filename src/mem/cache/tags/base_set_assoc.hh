@@ -85,6 +85,34 @@ protected:
     /** Replacement policy */
     replacement_policy::Base *replacementPolicy;
 
+    /** The associativity of the cache. */
+    const unsigned assoc;
+
+    /** Tag key of the ways that do not hold a valid block. */
+    static constexpr Addr invalidTagKey = MaxAddr;
+
+    /**
+     * Structure-of-arrays copy of the tag and secure bit of every block,
+     * laid out by set and way like blks. When the indexing policy maps
+     * an address to a single set, a lookup compares the keys of that set
+     * as one contiguous scan instead of dereferencing every block.
+     */
+    std::vector<Addr> tagKeys;
+
+    /** Combine a tag and a secure bit into a tag key. */
+    static Addr
+    tagKey(Addr tag, bool is_secure)
+    {
+        return (tag << 1) | is_secure;
+    }
+
+    /**
+     * Update the tag key of a block after its tag or valid bit changed.
+     *
+     * @param blk The block to update.
+     */
+    void updateTagKey(const CacheBlk *blk);
+
 public:
     /** Convenience typedef. */
     typedef BaseSetAssocParams Params;
@@ -112,6 +140,16 @@ public:
      */
     void invalidate(CacheBlk *blk) override;
 
+    /**
+     * Find a block using the tag keys of its set when the indexing policy
+     * allows it, and by checking every possible entry otherwise.
+     *
+     * @param addr The address to find.
+     * @param is_secure True if the target memory space is secure.
+     * @return Pointer to the cache block.
+     */
+    CacheBlk *findBlock(Addr addr, bool is_secure) const override;
+
     /**
      * Access block and update replacement data. May not succeed, in which case
      * nullptr is returned. This has all the implications of a cache access and
@@ -160,14 +198,19 @@ public:
      * @param is_secure True if the target memory space is secure.
      * @param size Size, in bits, of new block to allocate.
      * @param evict_blks Cache blocks to be evicted.
-     * @return Cache block to be replaced.
+     * @param partition_id Partition of the new block.
+     * @return Cache block to be replaced, nullptr if there is none.
      */
     CacheBlk *findVictim(Addr addr, const bool is_secure,
                          const std::size_t size,
-                         std::vector<CacheBlk *> &evict_blks) override {
-        // Get possible entries to be victimized
-        const std::vector<ReplaceableEntry *> entries =
-            indexingPolicy->getPossibleEntries(addr);
+                         std::vector<CacheBlk *> &evict_blks,
+                         uint64_t partition_id) override {
+        // Get possible entries to be victimized, among those the
+        // partition of the new block is allowed to replace
+        const std::vector<ReplaceableEntry *> &entries = partitionCandidates(
+            indexingPolicy->getPossibleEntries(addr), partition_id);
+        if (entries.empty())
+            return nullptr;
 
         // Choose replacement victim from replacement candidates
         CacheBlk *victim = static_cast<CacheBlk *>(replacementPolicy->getVictim(
@@ -188,6 +231,7 @@ public:
     void insertBlock(const PacketPtr pkt, CacheBlk *blk) override {
         // Insert block
         BaseTags::insertBlock(pkt, blk);
+        updateTagKey(blk);
 
         // Increment tag counter
         stats.tagsInUse++;
@@ -104,10 +104,11 @@ CompressedTags::tagsInit()
 CacheBlk*
 CompressedTags::findVictim(Addr addr, const bool is_secure,
                            const std::size_t compressed_size,
-                           std::vector<CacheBlk*>& evict_blks)
+                           std::vector<CacheBlk*>& evict_blks,
+                           uint64_t partition_id)
 {
     // Get all possible locations of this superblock
-    const std::vector<ReplaceableEntry*> superblock_entries =
+    const std::vector<ReplaceableEntry*> &superblock_entries =
         indexingPolicy->getPossibleEntries(addr);
 
     // Check if the superblock this address belongs to has been allocated. If
@@ -121,7 +122,8 @@ CompressedTags::findVictim(Addr addr, const bool is_secure,
         if (superblock->matchTag(tag, is_secure) &&
             !superblock->blks[offset]->isValid() &&
             superblock->isCompressed() &&
-            superblock->canCoAllocate(compressed_size))
+            superblock->canCoAllocate(compressed_size) &&
+            partitionAllowsCoAllocation(superblock, partition_id))
         {
             victim_superblock = superblock;
             is_co_allocation = true;
@@ -132,9 +134,15 @@ CompressedTags::findVictim(Addr addr, const bool is_secure,
     // If the superblock is not present or cannot be co-allocated a
     // superblock must be replaced
     if (victim_superblock == nullptr){
-        // Choose replacement victim from replacement candidates
+        // Choose replacement victim from the replacement candidates the
+        // partition of the new block is allowed to replace
+        const std::vector<ReplaceableEntry*> &candidates =
+            partitionCandidates(superblock_entries, partition_id);
+        if (candidates.empty()) {
+            return nullptr;
+        }
         victim_superblock = static_cast<SuperBlk*>(
-            replacementPolicy->getVictim(superblock_entries));
+            replacementPolicy->getVictim(candidates));
 
         // The whole superblock must be evicted to make room for the new one
         for (const auto& blk : victim_superblock->blks){
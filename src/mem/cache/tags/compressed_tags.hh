@@ -102,11 +102,13 @@ class CompressedTags : public SectorTags
      * @param is_secure True if the target memory space is secure.
      * @param compressed_size Size, in bits, of new block to allocate.
      * @param evict_blks Cache blocks to be evicted.
-     * @return Cache block to be replaced.
+     * @param partition_id Partition of the new block.
+     * @return Cache block to be replaced, nullptr if there is none.
      */
     CacheBlk* findVictim(Addr addr, const bool is_secure,
                          const std::size_t compressed_size,
-                         std::vector<CacheBlk*>& evict_blks) override;
+                         std::vector<CacheBlk*>& evict_blks,
+                         uint64_t partition_id) override;
 
     /**
      * Find if any of the sub-blocks satisfies a condition.
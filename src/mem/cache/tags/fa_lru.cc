@@ -74,6 +74,8 @@ FALRU::FALRU(const Params &p)
               blkSize);
     if (!isPowerOf2(size))
         fatal("Cache Size must be power of 2 for now");
+    fatal_if(partitionManager, "%s: a fully associative cache cannot be "
+             "partitioned", name());
 
     blks = new FALRUBlk[numBlocks];
 }
@@ -148,6 +150,9 @@ FALRU::accessBlock(const PacketPtr pkt, Cycles &lat,
     if (blk && blk->isValid()) {
         mask = blk->inCachesMask;
 
+        // Update number of references to accessed block
+        blk->increaseRefCount();
+
         moveToHead(blk);
     }
 
@@ -191,7 +196,7 @@ FALRU::findBlockBySetAndWay(int set, int way) const
 
 CacheBlk*
 FALRU::findVictim(Addr addr, const bool is_secure, const std::size_t size,
-                  std::vector<CacheBlk*>& evict_blks)
+                  std::vector<CacheBlk*>& evict_blks, uint64_t partition_id)
 {
     // The victim is always stored on the tail for the FALRU
     FALRUBlk* victim = tail;
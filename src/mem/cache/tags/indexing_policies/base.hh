@@ -47,6 +47,7 @@
 #ifndef __MEM_CACHE_INDEXING_POLICIES_BASE_HH__
 #define __MEM_CACHE_INDEXING_POLICIES_BASE_HH__
 
+#include <optional>
 #include <vector>
 
 #include "params/BaseIndexingPolicy.hh"
@@ -143,11 +144,29 @@ class BaseIndexingPolicy : public SimObject
      * Should be called immediately before ReplacementPolicy's findVictim()
      * not to break cache resizing.
      *
+     * The returned entries are owned by the indexing policy and no copy is
+     * made, so that lookups do not allocate. The reference is only valid
+     * until the next call to this function.
+     *
      * @param addr The addr to a find possible entries for.
      * @return The possible entries.
      */
-    virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
-                                                                    const = 0;
+    virtual const std::vector<ReplaceableEntry*> &
+    getPossibleEntries(const Addr addr) const = 0;
+
+    /**
+     * Get the set holding all the possible entries of an address, for
+     * policies where the ways of an address are laid out in a single set.
+     *
+     * @param addr The addr to find the set of.
+     * @return The set index, or nothing if the possible entries of the
+     *         address span several sets.
+     */
+    virtual std::optional<uint32_t>
+    getSet(const Addr addr) const
+    {
+        return std::nullopt;
+    }
 
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
@@ -115,8 +115,20 @@ class SetAssociative : public BaseIndexingPolicy
      * @param addr The addr to a find possible entries for.
      * @return The possible entries.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                     override;
+    const std::vector<ReplaceableEntry*> &
+    getPossibleEntries(const Addr addr) const override;
+
+    /**
+     * All the possible entries of an address belong to its set.
+     *
+     * @param addr The addr to find the set of.
+     * @return The set index of the address.
+     */
+    std::optional<uint32_t>
+    getSet(const Addr addr) const override
+    {
+        return extractSet(addr);
+    }
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
@@ -138,6 +138,13 @@ class SkewedAssociative : public BaseIndexingPolicy
      */
     uint32_t extractSet(const Addr addr, const uint32_t way) const;
 
+    /**
+     * The entries of an address are spread over one set per way, so they
+     * are gathered here by getPossibleEntries() instead of being copied
+     * into a new vector on every lookup.
+     */
+    mutable std::vector<ReplaceableEntry*> candidates;
+
   public:
     /** Convenience typedef. */
      typedef SkewedAssociativeParams Params;
@@ -160,8 +167,8 @@ class SkewedAssociative : public BaseIndexingPolicy
      * @param addr The addr to a find possible entries for.
      * @return The possible entries.
      */
-    std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                   override;
+    const std::vector<ReplaceableEntry*> &
+    getPossibleEntries(const Addr addr) const override;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
@@ -0,0 +1,70 @@
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+
+# What the partition of a request, and of the line it allocates, is
+# taken from: the memory region ID carried by the request (lines out of
+# any region belong to the unassigned partition), or its requestor ID.
+class PartitionKey(Enum):
+    vals = ["partition_by_region", "partition_by_requestor"]
+
+
+class BasePartitioningPolicy(SimObject):
+    type = "BasePartitioningPolicy"
+    abstract = True
+    cxx_header = "mem/cache/tags/partitioning_policies/base_pp.hh"
+    cxx_class = "gem5::partitioning_policy::BasePartitioningPolicy"
+
+
+class WayPartitioningPolicy(BasePartitioningPolicy):
+    """
+    CAT-style way partitioning: each listed partition may only allocate in
+    the ways set in its way mask. Partitions that are not listed may
+    allocate in every way.
+    """
+
+    type = "WayPartitioningPolicy"
+    cxx_header = "mem/cache/tags/partitioning_policies/way_pp.hh"
+    cxx_class = "gem5::partitioning_policy::WayPartitioningPolicy"
+
+    partition_ids = VectorParam.UInt64("Partitions with a way mask")
+    way_masks = VectorParam.UInt64(
+        "Ways each partition may allocate in, bit i standing for way i"
+    )
+
+
+class MaxCapacityPartitioningPolicy(BasePartitioningPolicy):
+    """
+    Capacity shares: once a listed partition holds its share of the cache
+    lines, it may only replace its own lines. Partitions that are not
+    listed are not limited.
+    """
+
+    type = "MaxCapacityPartitioningPolicy"
+    cxx_header = "mem/cache/tags/partitioning_policies/max_capacity_pp.hh"
+    cxx_class = "gem5::partitioning_policy::MaxCapacityPartitioningPolicy"
+
+    cache_size = Param.MemorySize(Parent.size, "Size of the cache")
+    blk_size = Param.Int(Parent.block_size, "Block size of the cache")
+
+    partition_ids = VectorParam.UInt64("Partitions with a capacity share")
+    capacities = VectorParam.Float(
+        "Maximum share of the cache lines of each partition, in [0, 1]"
+    )
+
+
+class PartitionManager(SimObject):
+    type = "PartitionManager"
+    cxx_header = "mem/cache/tags/partitioning_policies/partition_manager.hh"
+    cxx_class = "gem5::partitioning_policy::PartitionManager"
+
+    partition_key = Param.PartitionKey(
+        "partition_by_region", "What partitions the cache lines"
+    )
+    unassigned_partition = Param.UInt64(
+        255, "Partition of the lines out of any memory region"
+    )
+    partitioning_policies = VectorParam.BasePartitioningPolicy(
+        [], "Policies restricting the victims of each partition"
+    )
@@ -0,0 +1,67 @@
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_BASE_PP_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_BASE_PP_HH__
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
+#include "params/BasePartitioningPolicy.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+/**
+ * Get the partition of the line held by a replacement candidate, or
+ * nothing if the candidate is invalid.
+ */
+typedef std::function<std::optional<uint64_t>(const ReplaceableEntry *)>
+    PartitionOf;
+
+/**
+ * A partitioning policy restricts the replacement candidates a partition
+ * may pick its victim from.
+ */
+class BasePartitioningPolicy : public SimObject
+{
+  public:
+    typedef BasePartitioningPolicyParams Params;
+    BasePartitioningPolicy(const Params &p) : SimObject(p) {}
+
+    /**
+     * Remove the candidates a partition may not replace. The list may be
+     * left empty, in which case the line is not allocated.
+     *
+     * @param entries Replacement candidates, filtered in place.
+     * @param partition_id Partition of the line to allocate.
+     * @param partition_of Partition of the line of each candidate.
+     */
+    virtual void filterByPartition(std::vector<ReplaceableEntry *> &entries,
+                                   uint64_t partition_id,
+                                   const PartitionOf &partition_of) const = 0;
+
+    /**
+     * Check whether a partition may allocate a line without evicting one,
+     * as when it fills a sub-block of a sector that is already present.
+     */
+    virtual bool canGrow(uint64_t partition_id) const { return true; }
+
+    /** Notify that a line of the partition was allocated. */
+    virtual void notifyAcquire(uint64_t partition_id) {}
+
+    /** Notify that a line of the partition was invalidated. */
+    virtual void notifyRelease(uint64_t partition_id) {}
+
+    /** Get the partitions the policy restricts. */
+    virtual std::vector<uint64_t> getPartitionIds() const = 0;
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_BASE_PP_HH__
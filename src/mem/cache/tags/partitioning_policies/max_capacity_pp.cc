@@ -0,0 +1,84 @@
+#include "mem/cache/tags/partitioning_policies/max_capacity_pp.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+MaxCapacityPartitioningPolicy::MaxCapacityPartitioningPolicy(
+    const Params &p)
+    : BasePartitioningPolicy(p)
+{
+    fatal_if(p.partition_ids.size() != p.capacities.size(),
+             "%s: there must be a capacity per partition", name());
+
+    const uint64_t num_lines = p.cache_size / p.blk_size;
+    for (size_t i = 0; i < p.partition_ids.size(); i++) {
+        fatal_if(p.capacities[i] < 0 || p.capacities[i] > 1,
+                 "%s: capacity of partition %d is not in [0, 1]", name(),
+                 p.partition_ids[i]);
+        const uint64_t max_lines = std::floor(p.capacities[i] * num_lines);
+        fatal_if(!partitions.emplace(p.partition_ids[i],
+                                     Partition{max_lines, 0}).second,
+                 "%s: partition %d has several capacities", name(),
+                 p.partition_ids[i]);
+    }
+}
+
+void
+MaxCapacityPartitioningPolicy::filterByPartition(
+    std::vector<ReplaceableEntry *> &entries, uint64_t partition_id,
+    const PartitionOf &partition_of) const
+{
+    auto it = partitions.find(partition_id);
+    if (it == partitions.end() || it->second.lines < it->second.maxLines)
+        return;
+
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+        [&](const ReplaceableEntry *entry) {
+            return partition_of(entry) != partition_id;
+        }), entries.end());
+}
+
+bool
+MaxCapacityPartitioningPolicy::canGrow(uint64_t partition_id) const
+{
+    auto it = partitions.find(partition_id);
+    return it == partitions.end() || it->second.lines < it->second.maxLines;
+}
+
+void
+MaxCapacityPartitioningPolicy::notifyAcquire(uint64_t partition_id)
+{
+    auto it = partitions.find(partition_id);
+    if (it != partitions.end())
+        it->second.lines++;
+}
+
+void
+MaxCapacityPartitioningPolicy::notifyRelease(uint64_t partition_id)
+{
+    auto it = partitions.find(partition_id);
+    if (it != partitions.end()) {
+        assert(it->second.lines > 0);
+        it->second.lines--;
+    }
+}
+
+std::vector<uint64_t>
+MaxCapacityPartitioningPolicy::getPartitionIds() const
+{
+    std::vector<uint64_t> ids;
+    for (const auto &[id, partition] : partitions)
+        ids.push_back(id);
+    return ids;
+}
+
+} // namespace partitioning_policy
+} // namespace gem5
@@ -0,0 +1,53 @@
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_MAX_CAPACITY_PP_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_MAX_CAPACITY_PP_HH__
+
+#include <unordered_map>
+
+#include "mem/cache/tags/partitioning_policies/base_pp.hh"
+#include "params/MaxCapacityPartitioningPolicy.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+/**
+ * Limits each partition to a share of the cache lines. A partition under
+ * its share may replace any line, while a partition holding its share
+ * may only replace its own lines. If none of the candidates holds one of
+ * them, the line is not allocated.
+ */
+class MaxCapacityPartitioningPolicy : public BasePartitioningPolicy
+{
+  protected:
+    struct Partition
+    {
+        /** Maximum number of lines. */
+        uint64_t maxLines;
+        /** Number of lines held. */
+        uint64_t lines;
+    };
+
+    std::unordered_map<uint64_t, Partition> partitions;
+
+  public:
+    typedef MaxCapacityPartitioningPolicyParams Params;
+    MaxCapacityPartitioningPolicy(const Params &p);
+
+    void filterByPartition(std::vector<ReplaceableEntry *> &entries,
+                           uint64_t partition_id,
+                           const PartitionOf &partition_of) const override;
+
+    bool canGrow(uint64_t partition_id) const override;
+
+    void notifyAcquire(uint64_t partition_id) override;
+    void notifyRelease(uint64_t partition_id) override;
+
+    std::vector<uint64_t> getPartitionIds() const override;
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_MAX_CAPACITY_PP_HH__
@@ -0,0 +1,137 @@
+#include "mem/cache/tags/partitioning_policies/partition_manager.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "mem/cache/cache_blk.hh"
+#include "mem/request.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+PartitionManager::PartitionManager(const Params &p)
+    : SimObject(p), partitionKey(p.partition_key),
+      unassignedPartition(p.unassigned_partition),
+      partitioningPolicies(p.partitioning_policies), stats(*this)
+{
+    std::vector<uint64_t> ids;
+    for (const auto *policy : partitioningPolicies) {
+        const std::vector<uint64_t> policy_ids = policy->getPartitionIds();
+        ids.insert(ids.end(), policy_ids.begin(), policy_ids.end());
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    for (size_t i = 0; i < ids.size(); i++)
+        statIndices.emplace(ids[i], i);
+}
+
+size_t
+PartitionManager::statIndex(uint64_t partition_id) const
+{
+    auto it = statIndices.find(partition_id);
+    return it == statIndices.end() ? statIndices.size() : it->second;
+}
+
+uint64_t
+PartitionManager::partitionId(const PacketPtr pkt) const
+{
+    if (partitionKey == enums::partition_by_requestor)
+        return pkt->req->requestorId();
+
+    const int8_t region = pkt->req->getRegion();
+    return region < 0 ? unassignedPartition : region;
+}
+
+uint64_t
+PartitionManager::partitionId(const CacheBlk *blk) const
+{
+    assert(blk->isValid());
+    if (partitionKey == enums::partition_by_requestor)
+        return blk->getSrcRequestorId();
+
+    const int8_t region = blk->getRegion();
+    return region < 0 ? unassignedPartition : region;
+}
+
+void
+PartitionManager::filterByPartition(std::vector<ReplaceableEntry *> &entries,
+                                    uint64_t partition_id,
+                                    const PartitionOf &partition_of)
+{
+    for (const auto *policy : partitioningPolicies)
+        policy->filterByPartition(entries, partition_id, partition_of);
+
+    if (entries.empty())
+        stats.noVictims[statIndex(partition_id)]++;
+}
+
+bool
+PartitionManager::allowCoAllocation(ReplaceableEntry *entry,
+                                    uint64_t partition_id,
+                                    const PartitionOf &partition_of)
+{
+    std::vector<ReplaceableEntry *> entries{entry};
+    for (const auto *policy : partitioningPolicies) {
+        policy->filterByPartition(entries, partition_id, partition_of);
+        if (entries.empty() || !policy->canGrow(partition_id))
+            return false;
+    }
+    return true;
+}
+
+void
+PartitionManager::notifyAcquire(uint64_t partition_id)
+{
+    for (auto *policy : partitioningPolicies)
+        policy->notifyAcquire(partition_id);
+
+    stats.occupancies[statIndex(partition_id)]++;
+    stats.insertions[statIndex(partition_id)]++;
+}
+
+void
+PartitionManager::notifyRelease(uint64_t partition_id)
+{
+    for (auto *policy : partitioningPolicies)
+        policy->notifyRelease(partition_id);
+
+    stats.occupancies[statIndex(partition_id)]--;
+}
+
+PartitionManager::PartitionStats::PartitionStats(PartitionManager &_manager)
+    : statistics::Group(&_manager), manager(_manager),
+      ADD_STAT(occupancies, statistics::units::Count::get(),
+               "Lines held by each partition"),
+      ADD_STAT(insertions, statistics::units::Count::get(),
+               "Lines allocated by each partition"),
+      ADD_STAT(noVictims, statistics::units::Count::get(),
+               "Allocations of each partition with no allowed victim")
+{
+}
+
+void
+PartitionManager::PartitionStats::regStats()
+{
+    statistics::Group::regStats();
+
+    const size_t num_partitions = manager.statIndices.size() + 1;
+    occupancies.init(num_partitions);
+    insertions.init(num_partitions);
+    noVictims.init(num_partitions);
+
+    for (const auto &[id, index] : manager.statIndices) {
+        occupancies.subname(index, csprintf("partition%d", id));
+        insertions.subname(index, csprintf("partition%d", id));
+        noVictims.subname(index, csprintf("partition%d", id));
+    }
+    occupancies.subname(num_partitions - 1, "other");
+    insertions.subname(num_partitions - 1, "other");
+    noVictims.subname(num_partitions - 1, "other");
+}
+
+} // namespace partitioning_policy
+} // namespace gem5
@@ -0,0 +1,109 @@
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_PARTITION_MANAGER_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_PARTITION_MANAGER_HH__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "enums/PartitionKey.hh"
+#include "mem/cache/tags/partitioning_policies/base_pp.hh"
+#include "mem/packet.hh"
+#include "params/PartitionManager.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class CacheBlk;
+
+namespace partitioning_policy
+{
+
+/**
+ * Partitions the lines of a cache by memory region or by requestor, and
+ * applies its partitioning policies to the replacement candidates of
+ * every allocation. The tags tell the manager about every line they
+ * allocate and invalidate, so that the policies can track the occupancy
+ * of each partition.
+ */
+class PartitionManager : public SimObject
+{
+  protected:
+    const enums::PartitionKey partitionKey;
+
+    /** Partition of the lines out of any memory region. */
+    const uint64_t unassignedPartition;
+
+    const std::vector<BasePartitioningPolicy *> partitioningPolicies;
+
+    /**
+     * Stat index of each partition restricted by a policy. The last stat
+     * index stands for all the other partitions.
+     */
+    std::unordered_map<uint64_t, size_t> statIndices;
+
+    size_t statIndex(uint64_t partition_id) const;
+
+    struct PartitionStats : public statistics::Group
+    {
+        PartitionStats(PartitionManager &manager);
+
+        void regStats() override;
+
+        PartitionManager &manager;
+
+        /** Lines held by each partition. */
+        statistics::Vector occupancies;
+        /** Lines allocated by each partition. */
+        statistics::Vector insertions;
+        /** Allocations given up because no candidate was allowed. */
+        statistics::Vector noVictims;
+    } stats;
+
+  public:
+    typedef PartitionManagerParams Params;
+    PartitionManager(const Params &p);
+
+    /** Get the partition a packet allocates its line in. */
+    uint64_t partitionId(const PacketPtr pkt) const;
+
+    /** Get the partition of a valid cache line. */
+    uint64_t partitionId(const CacheBlk *blk) const;
+
+    /**
+     * Remove the replacement candidates a partition may not replace,
+     * according to every partitioning policy.
+     *
+     * @param entries Replacement candidates, filtered in place.
+     * @param partition_id Partition of the line to allocate.
+     * @param partition_of Partition of the line of each candidate.
+     */
+    void filterByPartition(std::vector<ReplaceableEntry *> &entries,
+                           uint64_t partition_id,
+                           const PartitionOf &partition_of);
+
+    /**
+     * Check whether a partition may allocate a line in a replacement
+     * candidate without evicting any of its lines, such as a sub-block of
+     * a sector that is already present.
+     *
+     * @param entry The candidate the line is allocated in.
+     * @param partition_id Partition of the line to allocate.
+     * @param partition_of Partition of the line of each candidate.
+     * @return Whether every partitioning policy allows the allocation.
+     */
+    bool allowCoAllocation(ReplaceableEntry *entry, uint64_t partition_id,
+                           const PartitionOf &partition_of);
+
+    /** Notify that a line of the partition was allocated. */
+    void notifyAcquire(uint64_t partition_id);
+
+    /** Notify that a line of the partition was invalidated. */
+    void notifyRelease(uint64_t partition_id);
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_PARTITION_MANAGER_HH__
@@ -0,0 +1,55 @@
+#include "mem/cache/tags/partitioning_policies/way_pp.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+WayPartitioningPolicy::WayPartitioningPolicy(const Params &p)
+    : BasePartitioningPolicy(p)
+{
+    fatal_if(p.partition_ids.size() != p.way_masks.size(),
+             "%s: there must be a way mask per partition", name());
+
+    for (size_t i = 0; i < p.partition_ids.size(); i++) {
+        fatal_if(p.way_masks[i] == 0,
+                 "%s: partition %d has no way to allocate in", name(),
+                 p.partition_ids[i]);
+        fatal_if(!wayMasks.emplace(p.partition_ids[i], p.way_masks[i]).second,
+                 "%s: partition %d has several way masks", name(),
+                 p.partition_ids[i]);
+    }
+}
+
+void
+WayPartitioningPolicy::filterByPartition(
+    std::vector<ReplaceableEntry *> &entries, uint64_t partition_id,
+    const PartitionOf &partition_of) const
+{
+    auto it = wayMasks.find(partition_id);
+    if (it == wayMasks.end())
+        return;
+
+    const uint64_t mask = it->second;
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+        [mask](const ReplaceableEntry *entry) {
+            return entry->getWay() >= 64 || !((mask >> entry->getWay()) & 1);
+        }), entries.end());
+}
+
+std::vector<uint64_t>
+WayPartitioningPolicy::getPartitionIds() const
+{
+    std::vector<uint64_t> ids;
+    for (const auto &[id, mask] : wayMasks)
+        ids.push_back(id);
+    return ids;
+}
+
+} // namespace partitioning_policy
+} // namespace gem5
@@ -0,0 +1,40 @@
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_WAY_PP_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_WAY_PP_HH__
+
+#include <unordered_map>
+
+#include "mem/cache/tags/partitioning_policies/base_pp.hh"
+#include "params/WayPartitioningPolicy.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+/**
+ * Allocates a subset of the ways to each partition, given as a way mask
+ * in the manner of Intel CAT capacity bitmasks. Masks may overlap, and
+ * partitions without a mask may use every way.
+ */
+class WayPartitioningPolicy : public BasePartitioningPolicy
+{
+  protected:
+    /** Way mask of each partition. */
+    std::unordered_map<uint64_t, uint64_t> wayMasks;
+
+  public:
+    typedef WayPartitioningPolicyParams Params;
+    WayPartitioningPolicy(const Params &p);
+
+    void filterByPartition(std::vector<ReplaceableEntry *> &entries,
+                           uint64_t partition_id,
+                           const PartitionOf &partition_of) const override;
+
+    std::vector<uint64_t> getPartitionIds() const override;
+};
+
+} // namespace partitioning_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_WAY_PP_HH__
@@ -65,6 +65,9 @@ SectorTags::SectorTags(const SectorTagsParams &p)
              "Block size must be at least 4 and a power of 2");
     fatal_if(!isPowerOf2(numBlocksPerSector),
              "# of blocks per sector must be non-zero and a power of 2");
+    fatal_if(partitionManager && replacementPolicy->needsAllCandidates(),
+             "%s: the replacement policy needs all the sectors of a set, "
+             "and cannot be used with a partition manager", name());
 }
 
 void
@@ -257,7 +260,7 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     const Addr offset = extractSectorOffset(addr);
 
     // Find all possible sector entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
+    const std::vector<ReplaceableEntry*> &entries =
         indexingPolicy->getPossibleEntries(addr);
 
     // Search for block
@@ -272,12 +275,25 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     return nullptr;
 }
 
+std::optional<uint64_t>
+SectorTags::entryPartition(const ReplaceableEntry *entry) const
+{
+    const SectorBlk* sector_blk = static_cast<const SectorBlk*>(entry);
+    for (const auto& blk : sector_blk->blks) {
+        if (blk->isValid()) {
+            return partitionManager->partitionId(blk);
+        }
+    }
+    return std::nullopt;
+}
+
 CacheBlk*
 SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
-                       std::vector<CacheBlk*>& evict_blks)
+                       std::vector<CacheBlk*>& evict_blks,
+                       uint64_t partition_id)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> sector_entries =
+    const std::vector<ReplaceableEntry*> &sector_entries =
         indexingPolicy->getPossibleEntries(addr);
 
     // Check if the sector this address belongs to has been allocated
@@ -291,11 +307,23 @@ SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
         }
     }
 
+    // A partition may not be allowed to grow into a sector already present
+    if (victim_sector != nullptr &&
+        !partitionAllowsCoAllocation(victim_sector, partition_id)) {
+        return nullptr;
+    }
+
     // If the sector is not present
     if (victim_sector == nullptr){
-        // Choose replacement victim from replacement candidates
+        // Choose replacement victim from the replacement candidates the
+        // partition of the new block is allowed to replace
+        const std::vector<ReplaceableEntry*> &candidates =
+            partitionCandidates(sector_entries, partition_id);
+        if (candidates.empty()) {
+            return nullptr;
+        }
         victim_sector = static_cast<SectorBlk*>(replacementPolicy->getVictim(
-                                                sector_entries));
+                                                candidates));
     }
 
     // Get the entry of the victim block within the sector
@@ -35,6 +35,7 @@
 #define __MEM_CACHE_TAGS_SECTOR_TAGS_HH__
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -105,6 +106,13 @@ class SectorTags : public BaseTags
         statistics::Vector evictionsReplacement;
     } sectorStats;
 
+    /**
+     * A sector may hold the lines of several partitions. It is given the
+     * partition of its first valid sub-block.
+     */
+    std::optional<uint64_t>
+    entryPartition(const ReplaceableEntry *entry) const override;
+
   public:
     /** Convenience typedef. */
      typedef SectorTagsParams Params;
@@ -171,11 +179,13 @@ class SectorTags : public BaseTags
      * @param is_secure True if the target memory space is secure.
      * @param size Size, in bits, of new block to allocate.
      * @param evict_blks Cache blocks to be evicted.
-     * @return Cache block to be replaced.
+     * @param partition_id Partition of the new block.
+     * @return Cache block to be replaced, nullptr if there is none.
      */
     CacheBlk* findVictim(Addr addr, const bool is_secure,
                          const std::size_t size,
-                         std::vector<CacheBlk*>& evict_blks) override;
+                         std::vector<CacheBlk*>& evict_blks,
+                         uint64_t partition_id) override;
 
     /**
      * Calculate a block's offset in a sector from the address.
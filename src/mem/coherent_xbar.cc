@@ -61,6 +61,11 @@ CoherentXBar::CoherentXBar(const CoherentXBarParams &p)
       maxRoutingTableSizeCheck(p.max_routing_table_size),
       pointOfCoherency(p.point_of_coherency),
       pointOfUnification(p.point_of_unification),
+      snoopRequestorId(p.snoop_filter && p.snoop_filter->bounded() ?
+                       p.system->getRequestorId(this, "snoop") :
+                       Request::invldRequestorId),
+      backInvalidateEvent([this] { sendBackInvalidations(); },
+                          name() + ".backInvalidateEvent"),
 
       ADD_STAT(snoops, statistics::units::Count::get(), "Total snoops"),
       ADD_STAT(snoopTraffic, statistics::units::Byte::get(), "Total snoop traffic"),
@@ -103,6 +108,9 @@ CoherentXBar::CoherentXBar(const CoherentXBarParams &p)
                                            csprintf("respLayer%d", i)));
         snoopRespPorts.push_back(new SnoopRespPort(*bp, *this));
     }
+
+    if (pointOfCoherency)
+        system->addCoherencePoint(this);
 }
 
 CoherentXBar::~CoherentXBar() {
@@ -296,6 +304,7 @@ bool CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id) {
     if (snoopFilter && snoop_caches) {
         // Let the snoop filter know about the success of the send operation
         snoopFilter->finishRequest(!success, addr, pkt->isSecure());
+        scheduleBackInvalidations();
     }
 
     // check if we were successful in sending the packet onwards
@@ -509,6 +518,11 @@ void CoherentXBar::recvTimingSnoopReq(PacketPtr pkt, PortID mem_side_port_id) {
     // we should only see express snoops from caches
     assert(pkt->isExpressSnoop());
 
+    if (pkt->isMaintRange()) {
+        forwardMaintRange(pkt, true);
+        return;
+    }
+
     // set the packet header and payload delay, for now use forward latency
     // @todo Assess the choice of latency further
     calcPacketTiming(pkt, forwardLatency * clockPeriod());
@@ -691,6 +705,70 @@ bool CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id) {
     return true;
 }
 
+void CoherentXBar::scheduleBackInvalidations() {
+    if (snoopFilter->hasBackInvalidations() &&
+        !backInvalidateEvent.scheduled()) {
+        schedule(backInvalidateEvent, clockEdge());
+    }
+}
+
+void CoherentXBar::sendBackInvalidations() {
+    for (const auto &inv : snoopFilter->takeBackInvalidations()) {
+        // Caches write dirty copies back as they would for any other
+        // clean and invalidate, but do not respond to it
+        Request::Flags flags = Request::CLEAN | Request::INVALIDATE;
+        if (inv.isSecure)
+            flags.set(Request::SECURE);
+        RequestPtr req = std::make_shared<Request>(
+            inv.addr, system->cacheLineSize(), flags,
+            snoopRequestorId);
+        Packet pkt(req, MemCmd::CleanInvalidReq);
+
+        DPRINTF(CoherentXBar, "%s: %s to %d holders\n", __func__,
+                pkt.print(), inv.ports.size());
+
+        for (const auto &p : inv.ports) {
+            if (system->isAtomicMode())
+                p->sendAtomicSnoop(&pkt);
+            else
+                p->sendTimingSnoopReq(&pkt);
+            assert(!pkt.cacheResponding());
+        }
+
+        snoops += inv.ports.size();
+    }
+}
+
+void CoherentXBar::maintainRange(Addr start, Addr size, bool invalidate) {
+    Request::Flags flags = Request::CLEAN;
+    if (invalidate)
+        flags.set(Request::INVALIDATE);
+    RequestPtr req = std::make_shared<Request>(start, size, flags,
+                                               snoopRequestorId);
+    Packet pkt(req, MemCmd::MaintRangeReq);
+    pkt.setExpressSnoop();
+
+    DPRINTF(CoherentXBar, "%s: %s\n", __func__, pkt.print());
+
+    transDist[pkt.cmdToIndex()]++;
+    forwardMaintRange(&pkt, !system->isAtomicMode());
+}
+
+void CoherentXBar::forwardMaintRange(PacketPtr pkt, bool is_timing) {
+    // The snoop filter only tracks single lines, so every cache above
+    // is told about the range. Their holder bits are left as they are,
+    // which is safe as the filter may be pessimistic.
+    for (const auto &p : snoopPorts) {
+        if (is_timing)
+            p->sendTimingSnoopReq(pkt);
+        else
+            p->sendAtomicSnoop(pkt);
+    }
+
+    snoops += snoopPorts.size();
+    snoopFanout.sample(snoopPorts.size());
+}
+
 void CoherentXBar::forwardTiming(PacketPtr pkt, PortID exclude_cpu_side_port_id,
                                  const std::vector<QueuedResponsePort *> &dests) {
     DPRINTF(CoherentXBar, "%s for %s\n", __func__, pkt->print());
@@ -761,6 +839,7 @@ Tick CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
             // avoid situations where atomic upward snoops sneak in
             // between and change the filter state
             snoopFilter->finishRequest(false, pkt->getAddr(), pkt->isSecure());
+            scheduleBackInvalidations();
 
             if (pkt->isEviction()) {
                 // for block-evicting packets, i.e. writebacks and
@@ -880,6 +959,11 @@ Tick CoherentXBar::recvAtomicSnoop(PacketPtr pkt, PortID mem_side_port_id) {
     snoops++;
     snoopTraffic += pkt_size;
 
+    if (pkt->isMaintRange()) {
+        forwardMaintRange(pkt, false);
+        return 0;
+    }
+
     // forward to all snoopers
     std::pair<MemCmd, Tick> snoop_result;
     Tick snoop_response_latency = 0;
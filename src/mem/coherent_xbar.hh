@@ -272,6 +272,32 @@ protected:
      */
     std::unique_ptr<Packet> pendingDelete;
 
+    /**
+     * Requestor id of the snoops created by the crossbar itself, the
+     * back-invalidations of the snoop filter and the bulk cache
+     * maintenance operations. It is only registered with the system when
+     * a bounded snoop filter can back-invalidate lines.
+     */
+    const RequestorID snoopRequestorId;
+
+    /**
+     * Invalidate the lines evicted by the snoop filter in the caches
+     * that hold them. The filter keeps steering snoops to these caches
+     * until the event happens, so the invalidations are sent outside of
+     * the transaction that caused the eviction.
+     */
+    void sendBackInvalidations();
+    EventFunctionWrapper backInvalidateEvent;
+
+    /** Schedule the back-invalidations queued by the snoop filter. */
+    void scheduleBackInvalidations();
+
+    /**
+     * Send a bulk cache maintenance operation to every snooping cache
+     * above, bypassing the snoop filter.
+     */
+    void forwardMaintRange(PacketPtr pkt, bool is_timing);
+
     bool recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id);
     bool recvTimingResp(PacketPtr pkt, PortID mem_side_port_id);
     void recvTimingSnoopReq(PacketPtr pkt, PortID mem_side_port_id);
@@ -403,6 +429,19 @@ public:
 
     CoherentXBar(const CoherentXBarParams &p);
 
+    /**
+     * Clean, and optionally invalidate, the lines of [start, start +
+     * size) in all the caches above this crossbar. The caches write
+     * their dirty lines back to memory in the background, so the
+     * operation does not block the caller, and lines accessed again in
+     * the meantime may be cached again.
+     *
+     * @param start Physical start address of the range.
+     * @param size Size of the range in bytes.
+     * @param invalidate Whether to also invalidate the lines.
+     */
+    void maintainRange(Addr start, Addr size, bool invalidate);
+
     virtual ~CoherentXBar();
 
     virtual void regStats();
@@ -40,6 +40,8 @@
 
 #include "mem/mem_ctrl.hh"
 
+#include <algorithm>
+
 #include "base/trace.hh"
 #include "debug/DRAM.hh"
 #include "debug/Drain.hh"
@@ -57,6 +59,104 @@ namespace gem5
 namespace memory
 {
 
+MemPacket*
+MemPacketQueue::BankQueue::oldest(uint32_t row) const
+{
+    auto it = rows.find(row);
+    return it == rows.end() ? nullptr : it->second.packets.front();
+}
+
+MemPacket*
+MemPacketQueue::BankQueue::oldestNotIn(uint32_t row) const
+{
+    // the rows are distinct, so at most the first head targets the row
+    for (const auto& [seq, head_row] : rowHeads) {
+        if (head_row != row)
+            return rows.at(head_row).packets.front();
+    }
+    return nullptr;
+}
+
+void
+MemPacketQueue::BankQueue::push(MemPacket* pkt)
+{
+    auto [it, inserted] = rows.try_emplace(pkt->row);
+    Row& row = it->second;
+    if (inserted) {
+        row.headSeq = pkt->queueSeq;
+        rowHeads.emplace(row.headSeq, pkt->row);
+    }
+    row.packets.push_back(pkt);
+    size++;
+}
+
+void
+MemPacketQueue::BankQueue::remove(MemPacket* pkt)
+{
+    auto it = rows.find(pkt->row);
+    assert(it != rows.end());
+    Row& row = it->second;
+    auto pos = std::find(row.packets.begin(), row.packets.end(), pkt);
+    assert(pos != row.packets.end());
+    bool was_head = pos == row.packets.begin();
+    row.packets.erase(pos);
+    size--;
+
+    if (!was_head)
+        return;
+
+    rowHeads.erase({row.headSeq, pkt->row});
+    if (row.packets.empty()) {
+        rows.erase(it);
+    } else {
+        row.headSeq = row.packets.front()->queueSeq;
+        rowHeads.emplace(row.headSeq, pkt->row);
+    }
+}
+
+void
+MemPacketQueue::push_back(MemPacket* pkt)
+{
+    pkt->queueSeq = nextSeq++;
+    packets.push_back(pkt);
+
+    if (pkt->isDram()) {
+        if (banks.size() <= pkt->pseudoChannel)
+            banks.resize(pkt->pseudoChannel + 1);
+        auto& channel_banks = banks[pkt->pseudoChannel];
+        if (channel_banks.size() <= pkt->bankId)
+            channel_banks.resize(pkt->bankId + 1);
+        channel_banks[pkt->bankId].push(pkt);
+    }
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::erase(iterator pos)
+{
+    MemPacket* pkt = *pos;
+    if (pkt->isDram())
+        banks[pkt->pseudoChannel][pkt->bankId].remove(pkt);
+    return packets.erase(pos);
+}
+
+MemPacketQueue::iterator
+MemPacketQueue::find(const MemPacket* pkt)
+{
+    auto pos = std::lower_bound(packets.begin(), packets.end(),
+        pkt->queueSeq, [](const MemPacket* p, uint64_t seq) {
+            return p->queueSeq < seq;
+        });
+    assert(pos != packets.end() && *pos == pkt);
+    return pos;
+}
+
+const std::vector<MemPacketQueue::BankQueue>&
+MemPacketQueue::dramBanks(uint8_t pseudo_channel) const
+{
+    static const std::vector<BankQueue> none;
+    return pseudo_channel < banks.size() ? banks[pseudo_channel] : none;
+}
+
 MemCtrl::MemCtrl(const MemCtrlParams &p) :
     qos::MemCtrl(p),
     port(name() + ".port", *this), isTimingMode(false),
@@ -174,6 +274,16 @@ MemCtrl::readQueueFull(unsigned int neededEntries) const
     return rdsize_new > readBufferSize;
 }
 
+double
+MemCtrl::queueOccupancy() const
+{
+    const double read_occupancy =
+        double(totalReadQueueSize + respQueue.size()) / readBufferSize;
+    const double write_occupancy =
+        double(totalWriteQueueSize) / writeBufferSize;
+    return std::min(1.0, std::max(read_occupancy, write_occupancy));
+}
+
 bool
 MemCtrl::writeQueueFull(unsigned int neededEntries) const
 {
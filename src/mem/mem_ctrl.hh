@@ -47,7 +47,9 @@
 #define __MEM_CTRL_HH__
 
 #include <deque>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -57,6 +59,7 @@
 #include "enums/MemSched.hh"
 #include "mem/qos/mem_ctrl.hh"
 #include "mem/qport.hh"
+#include "mem/queue_occupancy.hh"
 #include "params/MemCtrl.hh"
 #include "sim/eventq.hh"
 
@@ -156,6 +159,12 @@ class MemPacket
      */
     uint8_t _qosValue;
 
+    /**
+     * Arrival order of the packet in the MemPacketQueue holding it,
+     * assigned when the packet is appended to the queue
+     */
+    uint64_t queueSeq;
+
     /**
      * Set the packet QoS value
      * (interface compatibility with Packet)
@@ -210,14 +219,113 @@ class MemPacket
           _requestorId(pkt->requestorId()),
           read(is_read), dram(is_dram), pseudoChannel(_channel), rank(_rank),
           bank(_bank), row(_row), bankId(bank_id), addr(_addr), size(_size),
-          burstHelper(NULL), _qosValue(_pkt->qosValue())
+          burstHelper(NULL), _qosValue(_pkt->qosValue()), queueSeq(0)
     { }
 
 };
 
-// The memory packets are store in a multiple dequeue structure,
-// based on their QoS priority
-typedef std::deque<MemPacket*> MemPacketQueue;
+/**
+ * A FCFS queue of memory packets. Besides the packets in arrival order,
+ * the queue keeps the DRAM packets bucketed per pseudo channel, bank and
+ * row, so that the FR-FCFS scheduler can find the oldest row hit or the
+ * oldest row miss of every bank without walking the whole queue.
+ *
+ * Packets can only be appended at the back and removed from anywhere,
+ * so the arrival order, i.e. MemPacket::queueSeq, increases along the
+ * queue and a packet is found back from its arrival order by bisection.
+ */
+class MemPacketQueue
+{
+  public:
+
+    typedef std::deque<MemPacket*>::iterator iterator;
+    typedef std::deque<MemPacket*>::const_iterator const_iterator;
+    typedef std::deque<MemPacket*>::reverse_iterator reverse_iterator;
+
+    /** The DRAM packets queued to one bank, bucketed by row */
+    class BankQueue
+    {
+      public:
+
+        /** Number of packets queued to the bank */
+        unsigned size = 0;
+
+        bool empty() const { return size == 0; }
+
+        /**
+         * Oldest packet to a given row
+         *
+         * @return the packet or nullptr if no packet is queued to the row
+         */
+        MemPacket* oldest(uint32_t row) const;
+
+        /**
+         * Oldest packet to any other row than a given one
+         *
+         * @return the packet or nullptr if all packets target the row
+         */
+        MemPacket* oldestNotIn(uint32_t row) const;
+
+      private:
+
+        friend class MemPacketQueue;
+
+        struct Row
+        {
+            /** Packets to the row in arrival order */
+            std::deque<MemPacket*> packets;
+            /** Arrival order of the first packet, as kept in rowHeads */
+            uint64_t headSeq;
+        };
+
+        std::unordered_map<uint32_t, Row> rows;
+
+        /** Arrival order and row of the oldest packet of every row */
+        std::set<std::pair<uint64_t, uint32_t>> rowHeads;
+
+        void push(MemPacket* pkt);
+        void remove(MemPacket* pkt);
+    };
+
+    iterator begin() { return packets.begin(); }
+    iterator end() { return packets.end(); }
+    const_iterator begin() const { return packets.begin(); }
+    const_iterator end() const { return packets.end(); }
+    reverse_iterator rbegin() { return packets.rbegin(); }
+    reverse_iterator rend() { return packets.rend(); }
+
+    size_t size() const { return packets.size(); }
+    bool empty() const { return packets.empty(); }
+    MemPacket* front() const { return packets.front(); }
+    MemPacket* back() const { return packets.back(); }
+
+    void push_back(MemPacket* pkt);
+    void pop_front() { erase(packets.begin()); }
+    iterator erase(iterator pos);
+
+    /**
+     * Position of a queued packet, found by bisection on its arrival
+     * order.
+     */
+    iterator find(const MemPacket* pkt);
+
+    /**
+     * Queued DRAM packets of a pseudo channel, indexed by bank id. The
+     * vector only covers the banks that had packets queued so far, and
+     * banks without queued packets are empty.
+     */
+    const std::vector<BankQueue>& dramBanks(uint8_t pseudo_channel) const;
+
+  private:
+
+    std::deque<MemPacket*> packets;
+
+    /** Arrival order of the next packet */
+    uint64_t nextSeq = 0;
+
+    /** DRAM packets per pseudo channel and bank id */
+    std::vector<std::vector<BankQueue>> banks;
+};
 
 
 /**
@@ -243,7 +351,7 @@ typedef std::deque<MemPacket*> MemPacketQueue;
  * please cite the paper.
  *
  */
-class MemCtrl : public qos::MemCtrl
+class MemCtrl : public qos::MemCtrl, public QueueOccupancy
 {
   protected:
 
@@ -489,7 +597,7 @@ class MemCtrl : public qos::MemCtrl
      * as sizing the read queue, this and the main read queue need to
      * be added together.
      */
-    std::deque<MemPacket*> respQueue;
+    MemPacketQueue respQueue;
 
     /**
      * Holds count of commands issued in burst window starting at
@@ -775,6 +883,9 @@ class MemCtrl : public qos::MemCtrl
     Port &getPort(const std::string &if_name,
                   PortID idx=InvalidPortID) override;
 
+    /** The fuller of the read and write queues gives the occupancy. */
+    double queueOccupancy() const override;
+
     virtual void init() override;
     virtual void startup() override;
     virtual void drainResume() override;
@@ -268,6 +268,8 @@ const MemCmd::CommandInfo
             {{IsRequest}, InvalidCmd, "TlbiExtSync"},
             /* SnoopReq */
             {{IsRequest, IsSnoop}, InvalidCmd, "SnoopReq"},
+            /* MaintRangeReq */
+            {{IsRequest}, InvalidCmd, "MaintRangeReq"},
 };
 
 AddrRange
@@ -149,6 +149,9 @@ public:
         // Tlb shootdown
         TlbiExtSync,
         SnoopReq,
+        // Clean, and optionally invalidate, every line of an address
+        // range (see BaseCache::handleMaintRange)
+        MaintRangeReq,
         NUM_MEM_CMDS
     };
 
@@ -229,6 +232,7 @@ public:
     bool isEviction() const { return testCmdAttrib(IsEviction); }
     bool isClean() const { return testCmdAttrib(IsClean); }
     bool fromCache() const { return testCmdAttrib(FromCache); }
+    bool isMaintRange() const { return cmd == MaintRangeReq; }
 
     /**
      * A writeback is an eviction that carries data.
@@ -598,6 +602,7 @@ public:
     bool isEviction() const { return cmd.isEviction(); }
     bool isClean() const { return cmd.isClean(); }
     bool fromCache() const { return cmd.fromCache(); }
+    bool isMaintRange() const { return cmd.isMaintRange(); }
     bool isWriteback() const { return cmd.isWriteback(); }
     bool hasData() const { return cmd.hasData(); }
     bool hasRespData() const {
@@ -47,6 +47,7 @@
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -275,6 +276,41 @@ PhysicalMemory::isMemAddr(Addr addr) const
     return addrMap.contains(addr) != addrMap.end();
 }
 
+bool
+PhysicalMemory::mapFile(Addr addr, int fd, off_t offset, uint64_t size)
+{
+    if (size == 0 || addr % pageSize || offset % pageSize || size % pageSize)
+        return false;
+
+    const AddrRange range = RangeSize(addr, size);
+    for (auto &s : backingStore) {
+        if (!range.isSubset(s.range))
+            continue;
+
+        // A private mapping would detach the range from the other
+        // processes sharing the backing store
+        if (s.shmFd != -1)
+            return false;
+
+        uint8_t *host = s.pmem + (addr - s.range.start());
+        if (reinterpret_cast<uintptr_t>(host) % pageSize)
+            return false;
+
+        DPRINTF(AddrRanges, "Mapping %s at offset %llu copy-on-write "
+                "to %s\n", range.to_string(), (uint64_t)offset,
+                s.range.to_string());
+
+        // Failing now would leave a hole in the backing store
+        void *pmem = mmap(host, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_FIXED, fd, offset);
+        panic_if(pmem == MAP_FAILED, "Could not mmap %s copy-on-write: %s",
+                 range.to_string(), strerror(errno));
+        return true;
+    }
+
+    return false;
+}
+
 AddrRangeList
 PhysicalMemory::getConfAddrRanges() const
 {
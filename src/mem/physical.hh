@@ -213,6 +213,27 @@ class PhysicalMemory : public Serializable
      */
     bool isMemAddr(Addr addr) const;
 
+    /**
+     * Map part of a file copy-on-write over the backing store, so that
+     * the pages are shared with every other process mapping the same
+     * file until they are written. The mapping bypasses the memory
+     * system, and is only meant for loading images before the
+     * simulation starts.
+     *
+     * @param addr A physical address, aligned to the host page size
+     * @param fd A file descriptor open for reading
+     * @param offset Offset in the file, aligned to the host page size
+     * @param size Number of bytes, a multiple of the host page size
+     * @return Whether the range was mapped, it cannot be if it is not
+     *         within a single private backing store
+     */
+    bool mapFile(Addr addr, int fd, off_t offset, uint64_t size);
+
+    /**
+     * Get the host page size, the granularity of mapFile.
+     */
+    Addr hostPageSize() const { return pageSize; }
+
     /**
      * Get the memory ranges for all memories that are to be reported
      * to the configuration table. The ranges are merged before they
@@ -38,6 +38,7 @@
 #include "mem/port_proxy.hh"
 
 #include "base/chunk_generator.hh"
+#include "base/intmath.hh"
 #include "cpu/thread_context.hh"
 #include "mem/port.hh"
 
@@ -88,6 +89,29 @@ void PortProxy::memsetBlobPhys(Addr addr, Request::Flags flags,
     delete[] buf;
 }
 
+void PortProxy::writeFileBlobPhys(Addr addr, Request::Flags flags,
+                                  const void *p, uint64_t size,
+                                  int fd, off_t offset) const {
+    if (fileMapper && (addr - offset) % fileMapPageSize == 0) {
+        // Only the whole pages can be mapped, and only if the address
+        // and the file offset have the same offset within a page
+        Addr start = roundUp(addr, fileMapPageSize);
+        Addr end = roundDown(addr + size, fileMapPageSize);
+        if (start < end &&
+            fileMapper(start, fd, offset + (start - addr), end - start)) {
+            const uint8_t *data = static_cast<const uint8_t *>(p);
+            if (start > addr)
+                writeBlobPhys(addr, flags, data, start - addr);
+            if (addr + size > end)
+                writeBlobPhys(end, flags, data + (end - addr),
+                              addr + size - end);
+            return;
+        }
+    }
+
+    writeBlobPhys(addr, flags, p, size);
+}
+
 bool PortProxy::tryWriteString(Addr addr, const char *str) const {
     do {
         if (!tryWriteBlob(addr++, str, 1))
@@ -57,6 +57,8 @@
 #ifndef __MEM_PORT_PROXY_HH__
 #define __MEM_PORT_PROXY_HH__
 
+#include <sys/types.h>
+
 #include <functional>
 #include <limits>
 
@@ -88,12 +90,23 @@ class PortProxy : FunctionalRequestProtocol
   public:
     typedef std::function<void(PacketPtr pkt)> SendFunctionalFunc;
 
+    /**
+     * Maps size bytes of the file fd at offset copy-on-write at the
+     * physical address addr, and returns false if it cannot.
+     */
+    typedef std::function<bool(Addr addr, int fd, off_t offset,
+                               uint64_t size)> FileMapFunc;
+
   private:
     SendFunctionalFunc sendFunctional;
 
     /** Granularity of any transactions issued through this proxy. */
     const Addr _cacheLineSize;
 
+    /** Optional mapper of file-backed writes, and its page size. */
+    FileMapFunc fileMapper;
+    Addr fileMapPageSize = 0;
+
     void
     recvFunctionalSnoop(PacketPtr pkt) override
     {
@@ -113,6 +126,18 @@ class PortProxy : FunctionalRequestProtocol
 
     virtual ~PortProxy() {}
 
+    /**
+     * Let writeFileBlob map the whole pages of file-backed writes with
+     * func instead of writing them through the port. The mapping bypasses
+     * the memory system, so it is only meant for loading images before
+     * the simulation starts.
+     */
+    void
+    setFileMapper(FileMapFunc func, Addr page_size)
+    {
+        fileMapper = std::move(func);
+        fileMapPageSize = page_size;
+    }
 
     /** Fixed functionality for use in base classes. */
 
@@ -134,6 +159,14 @@ class PortProxy : FunctionalRequestProtocol
     void memsetBlobPhys(Addr addr, Request::Flags flags,
                         uint8_t v, uint64_t size) const;
 
+    /**
+     * Write size bytes from p, read from the file fd at offset, to
+     * physical address. The pages that lie entirely within the range are
+     * mapped from the file if there is a file mapper, the rest is copied.
+     */
+    void writeFileBlobPhys(Addr addr, Request::Flags flags, const void *p,
+                           uint64_t size, int fd, off_t offset) const;
+
 
 
     /** Methods to override in base classes */
@@ -171,6 +204,19 @@ class PortProxy : FunctionalRequestProtocol
         return true;
     }
 
+    /**
+     * Write size bytes from p to address, where p holds the data of the
+     * file fd at offset.
+     * Returns true on success and false on failure.
+     */
+    virtual bool
+    tryWriteFileBlob(Addr addr, const void *p, uint64_t size,
+                     int fd, off_t offset) const
+    {
+        writeFileBlobPhys(addr, 0, p, size, fd, offset);
+        return true;
+    }
+
 
 
     /** Higher level interfaces based on the above. */
@@ -205,6 +251,17 @@ class PortProxy : FunctionalRequestProtocol
             fatal("memsetBlob(%#x, ...) failed", addr);
     }
 
+    /**
+     * Same as tryWriteFileBlob, but insists on success.
+     */
+    void
+    writeFileBlob(Addr addr, const void *p, uint64_t size,
+                  int fd, off_t offset) const
+    {
+        if (!tryWriteFileBlob(addr, p, size, fd, offset))
+            fatal("writeFileBlob(%#x, ...) failed", addr);
+    }
+
     /**
      * Read sizeof(T) bytes from address and return as object T.
      */
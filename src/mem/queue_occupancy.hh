@@ -0,0 +1,31 @@
+#ifndef __MEM_QUEUE_OCCUPANCY_HH__
+#define __MEM_QUEUE_OCCUPANCY_HH__
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * Interface of the memory controllers that report how full their request
+ * queues are, so that requestors such as the prefetchers can back off
+ * when the memory is loaded.
+ */
+class QueueOccupancy
+{
+  public:
+    virtual ~QueueOccupancy() = default;
+
+    /**
+     * Get the fraction of the request queue entries in use.
+     *
+     * @return The occupancy, in [0, 1].
+     */
+    virtual double queueOccupancy() const = 0;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_QUEUE_OCCUPANCY_HH__
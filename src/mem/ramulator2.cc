@@ -1,5 +1,7 @@
 #include "mem/ramulator2.hh"
 
+#include <algorithm>
+
 #include "base/callback.hh"
 #include "base/trace.hh"
 #include "debug/Ramulator2.hh"
@@ -27,6 +29,7 @@ Ramulator2::Ramulator2(const Params &p) : AbstractMemory(p),
                                           system_id(p.system_id), system_count(p.system_count),
                                           retryReq(false), retryResp(false), startTick(0),
                                           nbrOutstandingReads(0), nbrOutstandingWrites(0),
+                                          queueCapacity(0),
                                           sendResponseEvent([this] { sendResponse(); }, name()),
                                           tickEvent([this] { tick(); }, name()) {
     DPRINTF(Ramulator2, "Instantiated Ramulator2 \n");
@@ -51,6 +54,7 @@ void Ramulator2::init() {
     int new_queue_size = prev_queue_size * enlarge_buffer_factor;
     printf("Ramulator2 enlarged buffer size by %d from %d to %d\n", enlarge_buffer_factor, prev_queue_size, new_queue_size);
     config["MemorySystem"]["Controller"]["queue_size"] = new_queue_size;
+    queueCapacity = new_queue_size;
     ramulator2_frontend = Ramulator::Factory::create_frontend(config);
     ramulator2_memorysystem = Ramulator::Factory::create_memory_system(config);
 
@@ -65,6 +69,15 @@ void Ramulator2::init() {
     //           wrapper.burstSize(), system()->cacheLineSize());
 }
 
+double Ramulator2::queueOccupancy() const {
+    if (queueCapacity == 0)
+        return 0;
+    // Writes are acknowledged as soon as they are enqueued, but they
+    // hold their queue entry until Ramulator2 completes them
+    return std::min(1.0, double(nbrOutstandingReads + nbrOutstandingWrites) /
+                             queueCapacity);
+}
+
 void Ramulator2::startup() {
     startTick = curTick();
 
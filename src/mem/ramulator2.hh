@@ -6,6 +6,7 @@
 #include <unordered_map>
 
 #include "mem/abstract_mem.hh"
+#include "mem/queue_occupancy.hh"
 #include "params/Ramulator2.hh"
 
 // Forward declare Ramulator2 top-level components
@@ -18,7 +19,7 @@ namespace gem5 {
 
 namespace memory {
 
-class Ramulator2 : public AbstractMemory {
+class Ramulator2 : public AbstractMemory, public QueueOccupancy {
 private:
     class MemorySystemPort : public ResponsePort {
 
@@ -66,6 +67,9 @@ private:
     unsigned int nbrOutstandingReads;
     unsigned int nbrOutstandingWrites;
 
+    /** Request queue size of the Ramulator2 controller. */
+    unsigned int queueCapacity;
+
     /**
      * Queue to hold response packets until we can send them
      * back. This is needed as Ramulator2 unconditionally passes
@@ -119,6 +123,12 @@ public:
     void init() override;
     void startup() override;
 
+    /**
+     * The requests still in the Ramulator2 controller, relative to its
+     * queue size, give the occupancy.
+     */
+    double queueOccupancy() const override;
+
     void resetStats() override;
     void preDumpStats() override;
     void getAddrMapData(std::vector<int> &m_org,
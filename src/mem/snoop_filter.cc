@@ -51,15 +51,128 @@ namespace gem5 {
 
 const int SnoopFilter::SNOOP_MASK_SIZE;
 
-void SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator &sf_it) {
-    SnoopItem &sf_item = sf_it->second;
-    if ((sf_item.requested | sf_item.holder).none()) {
-        cachedLocations.erase(sf_it);
+SnoopFilter::SnoopFilter(const SnoopFilterParams &p)
+    : SimObject(p), assoc(p.assoc), numSets(0),
+      replacementPolicy(p.replacement_policy),
+      linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
+      maxEntryCount(p.max_capacity * 4 / p.system->cacheLineSize()),
+      stats(this) {
+    if (p.entries == 0)
+        return;
+
+    fatal_if(assoc == 0 || p.entries % assoc != 0,
+             "%s: %d entries cannot be split in sets of %d ways\n",
+             name(), p.entries, assoc);
+    fatal_if(!replacementPolicy,
+             "%s: a bounded snoop filter needs a replacement policy\n",
+             name());
+
+    numSets = p.entries / assoc;
+    entries.resize(p.entries);
+    for (unsigned i = 0; i < entries.size(); ++i) {
+        entries[i].setPosition(i / assoc, i % assoc);
+        entries[i].replacementData = replacementPolicy->instantiateEntry();
+    }
+}
+
+SnoopFilter::SnoopItem *
+SnoopFilter::findItem(Addr line_addr) {
+    if (bounded()) {
+        SnoopEntry *set = &entries[(line_addr / linesize) % numSets * assoc];
+        for (unsigned way = 0; way < assoc; ++way) {
+            if (set[way].valid && set[way].lineAddr == line_addr) {
+                replacementPolicy->touch(set[way].replacementData);
+                return &set[way];
+            }
+        }
+        if (cachedLocations.empty())
+            return nullptr;
+    }
+
+    auto sf_it = cachedLocations.find(line_addr);
+    return sf_it == cachedLocations.end() ? nullptr : &sf_it->second;
+}
+
+SnoopFilter::SnoopItem *
+SnoopFilter::allocateItem(Addr line_addr) {
+    if (!bounded())
+        return &cachedLocations.emplace(line_addr, SnoopItem()).first->second;
+
+    // Prefer a free way, and otherwise only consider the lines without
+    // requests in flight, as the filter would otherwise not be able to
+    // match their responses
+    SnoopEntry *set = &entries[(line_addr / linesize) % numSets * assoc];
+    SnoopEntry *victim = nullptr;
+    ReplacementCandidates candidates;
+    for (unsigned way = 0; way < assoc && !victim; ++way) {
+        if (!set[way].valid)
+            victim = &set[way];
+        else if (set[way].requested.none())
+            candidates.push_back(&set[way]);
+    }
+
+    if (!victim) {
+        if (candidates.empty()) {
+            stats.overflows++;
+            DPRINTF(SnoopFilter, "%s:   set of %#x overflows\n", __func__,
+                    line_addr);
+            SnoopItem &sf_item = cachedLocations[line_addr];
+            sf_item.holder = pendingHolders(line_addr);
+            return &sf_item;
+        }
+
+        victim = static_cast<SnoopEntry *>(
+            replacementPolicy->getVictim(candidates));
+        DPRINTF(SnoopFilter, "%s:   evicting %#x, SF value %x.%x\n",
+                __func__, victim->lineAddr, victim->requested,
+                victim->holder);
+        reqLookupResult.evicted = true;
+        reqLookupResult.evictedAddr = victim->lineAddr;
+        reqLookupResult.evictedHolder = victim->holder;
+    }
+
+    victim->lineAddr = line_addr;
+    victim->valid = true;
+    victim->requested = 0;
+    victim->holder = pendingHolders(line_addr);
+    replacementPolicy->reset(victim->replacementData);
+    return victim;
+}
+
+void SnoopFilter::eraseIfNullEntry(Addr line_addr, SnoopItem *sf_item) {
+    if ((sf_item->requested | sf_item->holder).none()) {
+        auto sf_it = cachedLocations.find(line_addr);
+        if (sf_it != cachedLocations.end()) {
+            cachedLocations.erase(sf_it);
+        } else {
+            SnoopEntry *entry = static_cast<SnoopEntry *>(sf_item);
+            entry->valid = false;
+            replacementPolicy->invalidate(entry->replacementData);
+        }
         DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n",
                 __func__);
     }
 }
 
+SnoopFilter::SnoopMask
+SnoopFilter::pendingHolders(Addr line_addr) const {
+    SnoopMask holders = 0;
+    for (const auto &inv : backInvalidations) {
+        if ((inv.addr | (inv.isSecure ? LineSecure : 0)) == line_addr) {
+            for (const auto &p : inv.ports)
+                holders |= portToMask(*p);
+        }
+    }
+    return holders;
+}
+
+std::vector<SnoopFilter::BackInvalidation>
+SnoopFilter::takeBackInvalidations() {
+    std::vector<BackInvalidation> res;
+    res.swap(backInvalidations);
+    return res;
+}
+
 std::pair<SnoopFilter::SnoopList, Cycles>
 SnoopFilter::lookupRequest(const Packet *cpkt, const ResponsePort &
                                                    cpu_side_port) {
@@ -73,22 +186,24 @@ SnoopFilter::lookupRequest(const Packet *cpkt, const ResponsePort &
         line_addr |= LineSecure;
     }
     SnoopMask req_port = portToMask(cpu_side_port);
-    reqLookupResult.it = cachedLocations.find(line_addr);
-    bool is_hit = (reqLookupResult.it != cachedLocations.end());
+    reqLookupResult.item = findItem(line_addr);
+    reqLookupResult.lineAddr = line_addr;
+    reqLookupResult.evicted = false;
+    bool is_hit = reqLookupResult.item != nullptr;
 
     // If the snoop filter has no entry, and we should not allocate,
     // do not create a new snoop filter entry, simply return a NULL
-    // portlist.
-    if (!is_hit && !allocate)
+    // portlist. A bounded filter may have evicted the line of an
+    // eviction, which then has nothing left to update.
+    if (!is_hit && (!allocate || (bounded() && cpkt->isEviction())))
         return snoopDown(lookupLatency);
 
-    // If no hit in snoop filter create a new element and update iterator
+    // If no hit in snoop filter create a new element
     if (!is_hit) {
-        reqLookupResult.it =
-            cachedLocations.emplace(line_addr, SnoopItem()).first;
+        reqLookupResult.item = allocateItem(line_addr);
         DPRINTF(SnoopFilter, "%s:   new SF entry allocated\n", __func__);
     }
-    SnoopItem &sf_item = reqLookupResult.it->second;
+    SnoopItem &sf_item = *reqLookupResult.item;
     SnoopMask interested = sf_item.holder | sf_item.requested;
 
     // Store unmodified value of snoop filter item in temp storage in
@@ -127,17 +242,23 @@ SnoopFilter::lookupRequest(const Packet *cpkt, const ResponsePort &
             // NOTE: The memInhibit might have been asserted by a cache closer
             // to the CPU, already -> the response will not be seen by this
             // filter -> we do not need to keep the in-flight request, but make
-            // sure that we know that that cluster has a copy
-            panic_if((sf_item.holder & req_port).none(),
+            // sure that we know that that cluster has a copy. A bounded
+            // filter may have evicted the line while the cluster still
+            // held it, and learns about the copy again here.
+            panic_if(!bounded() && (sf_item.holder & req_port).none(),
                      "Need to hold the value!");
+            sf_item.holder |= req_port;
             DPRINTF(SnoopFilter,
                     "%s: not marking request. SF value %x.%x\n",
                     __func__, sf_item.requested, sf_item.holder);
         }
     } else { // if (!cpkt->needsResponse())
         assert(cpkt->isEviction());
-        // make sure that the sender actually had the line
-        panic_if((sf_item.holder & req_port).none(), "requestor %x is not a "
+        // make sure that the sender actually had the line, unless a
+        // bounded filter evicted it and reallocated it for another
+        // requestor in the meantime
+        panic_if(!bounded() && (sf_item.holder & req_port).none(),
+                 "requestor %x is not a "
                                                      "holder :( SF value %x.%x\n",
                  req_port,
                  sf_item.requested, sf_item.holder);
@@ -154,24 +275,44 @@ SnoopFilter::lookupRequest(const Packet *cpkt, const ResponsePort &
 }
 
 void SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure) {
-    if (reqLookupResult.it != cachedLocations.end()) {
+    if (reqLookupResult.item) {
         // since we rely on the caller, do a basic check to ensure
         // that finishRequest is being called following lookupRequest
-        assert(reqLookupResult.it->first ==
+        assert(reqLookupResult.lineAddr ==
                (is_secure ? ((addr & ~(Addr(linesize - 1))) | LineSecure) : (addr & ~(Addr(linesize - 1)))));
         if (will_retry) {
             SnoopItem retry_item = reqLookupResult.retryItem;
             // Undo any changes made in lookupRequest to the snoop filter
             // entry if the request will come again. retryItem holds
             // the previous value of the snoopfilter entry.
-            reqLookupResult.it->second = retry_item;
+            *reqLookupResult.item = retry_item;
 
             DPRINTF(SnoopFilter, "%s:   restored SF value %x.%x\n",
                     __func__, retry_item.requested, retry_item.holder);
+
+            // Give the way back to the line evicted for the request, so
+            // that retries do not evict more lines
+            if (reqLookupResult.evicted) {
+                SnoopEntry *entry =
+                    static_cast<SnoopEntry *>(reqLookupResult.item);
+                entry->lineAddr = reqLookupResult.evictedAddr;
+                entry->holder = reqLookupResult.evictedHolder;
+                DPRINTF(SnoopFilter, "%s:   restored evicted line %#x\n",
+                        __func__, entry->lineAddr);
+            }
+        } else if (reqLookupResult.evicted &&
+                   reqLookupResult.evictedHolder.any()) {
+            backInvalidations.push_back(
+                {reqLookupResult.evictedAddr & ~Addr(LineSecure),
+                 (reqLookupResult.evictedAddr & LineSecure) != 0,
+                 maskToPortList(reqLookupResult.evictedHolder)});
+            stats.backInvalidations++;
         }
 
-        eraseIfNullEntry(reqLookupResult.it);
+        eraseIfNullEntry(reqLookupResult.lineAddr, reqLookupResult.item);
+        reqLookupResult.item = nullptr;
     }
+    reqLookupResult.evicted = false;
 }
 
 std::pair<SnoopFilter::SnoopList, Cycles>
@@ -184,10 +325,10 @@ SnoopFilter::lookupSnoop(const Packet *cpkt) {
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = (sf_it != cachedLocations.end());
+    SnoopItem *sf_it = findItem(line_addr);
+    bool is_hit = sf_it != nullptr;
 
-    if (!is_hit && (cachedLocations.size() >= maxEntryCount)) {
+    if (!is_hit && !bounded() && (cachedLocations.size() >= maxEntryCount)) {
         DPRINTFN("snoop filter cached locations %d >= %d cache blocks\n", cachedLocations.size(), maxEntryCount);
         int i = 0;
         for (auto it = cachedLocations.begin(); it != cachedLocations.end(); it++) {
@@ -199,11 +340,16 @@ SnoopFilter::lookupSnoop(const Packet *cpkt) {
 
     // If the snoop filter has no entry, simply return a NULL
     // portlist, there is no point creating an entry only to remove it
-    // later
-    if (!is_hit)
+    // later. The holders of a line evicted from a bounded filter must
+    // still see the snoop until they are invalidated.
+    if (!is_hit) {
+        SnoopMask pending = bounded() ? pendingHolders(line_addr) : 0;
+        if (pending.any())
+            return snoopSelected(maskToPortList(pending), lookupLatency);
         return snoopDown(lookupLatency);
+    }
 
-    SnoopItem &sf_item = sf_it->second;
+    SnoopItem &sf_item = *sf_it;
 
     SnoopMask interested = (sf_item.holder | sf_item.requested);
 
@@ -233,7 +379,7 @@ SnoopFilter::lookupSnoop(const Packet *cpkt) {
         sf_item.holder = 0;
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_it);
     }
 
     return snoopSelected(maskToPortList(interested), lookupLatency);
@@ -261,7 +407,10 @@ void SnoopFilter::updateSnoopResponse(const Packet *cpkt,
     }
     SnoopMask rsp_mask = portToMask(rsp_port);
     SnoopMask req_mask = portToMask(req_port);
-    SnoopItem &sf_item = cachedLocations[line_addr];
+    SnoopItem *sf_it = findItem(line_addr);
+    // The original request keeps the line from being evicted
+    panic_if(!sf_it, "No SF entry for %#x\n", line_addr);
+    SnoopItem &sf_item = *sf_it;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__, sf_item.requested, sf_item.holder);
@@ -308,8 +457,8 @@ void SnoopFilter::updateSnoopForward(const Packet *cpkt,
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    bool is_hit = sf_it != cachedLocations.end();
+    SnoopItem *sf_it = findItem(line_addr);
+    bool is_hit = sf_it != nullptr;
 
     // Nothing to do if it is not a hit
     if (!is_hit)
@@ -319,7 +468,7 @@ void SnoopFilter::updateSnoopForward(const Packet *cpkt,
     // Modified state, and we know that there are no other copies, or
     // they will all be invalidated imminently
     if (!cpkt->hasSharers()) {
-        SnoopItem &sf_item = sf_it->second;
+        SnoopItem &sf_item = *sf_it;
 
         DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
@@ -327,7 +476,7 @@ void SnoopFilter::updateSnoopForward(const Packet *cpkt,
         DPRINTF(SnoopFilter, "%s:   new SF value %x.%x\n",
                 __func__, sf_item.requested, sf_item.holder);
 
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_it);
     }
 }
 
@@ -348,12 +497,12 @@ void SnoopFilter::updateResponse(const Packet *cpkt, const ResponsePort &
     if (cpkt->isSecure()) {
         line_addr |= LineSecure;
     }
-    auto sf_it = cachedLocations.find(line_addr);
-    if (sf_it == cachedLocations.end())
+    SnoopItem *sf_it = findItem(line_addr);
+    if (!sf_it)
         return;
 
     SnoopMask response_mask = portToMask(cpu_side_port);
-    SnoopItem &sf_item = sf_it->second;
+    SnoopItem &sf_item = *sf_it;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__, sf_item.requested, sf_item.holder);
@@ -373,7 +522,7 @@ void SnoopFilter::updateResponse(const Packet *cpkt, const ResponsePort &
             panic_if(cpkt->getAddr() < 400000000, "Invalidating response for address 0x%lx\n", cpkt->getAddr());
             sf_item.holder = 0;
         }
-        eraseIfNullEntry(sf_it);
+        eraseIfNullEntry(line_addr, sf_it);
     } else {
         // Any other response implies that a cache above will have the
         // block.
@@ -401,7 +550,13 @@ SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
                "holder of the requested data."),
       ADD_STAT(hitMultiSnoops, statistics::units::Count::get(),
                "Number of snoops hitting in the snoop filter with multiple "
-               "(>1) holders of the requested data.") {}
+               "(>1) holders of the requested data."),
+      ADD_STAT(backInvalidations, statistics::units::Count::get(),
+               "Number of lines evicted from a bounded snoop filter while "
+               "cached above, which had to be invalidated."),
+      ADD_STAT(overflows, statistics::units::Count::get(),
+               "Number of lines tracked outside of a bounded snoop filter "
+               "because every way of their set had a request in flight.") {}
 
 void SnoopFilter::regStats() {
     SimObject::regStats();
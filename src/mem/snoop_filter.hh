@@ -46,7 +46,10 @@
 #include <bitset>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "mem/qport.hh"
@@ -84,6 +87,14 @@ namespace gem5 {
  *     upper cache dropped a line, making the snoop filter pessimistic for now
  * (4) ordering: there is no single point of order in the system.  Instead,
  *     requesting MSHRs track order between local requests and remote snoops
+ *
+ * By default the filter tracks every line cached above it. When given a
+ * number of entries, it is instead organised as a set-associative
+ * structure, like the directory of an inclusive cache: allocating a line
+ * in a full set evicts a line chosen by the replacement policy, and the
+ * caches holding the evicted line must be invalidated. The filter only
+ * records these back-invalidations, it is up to the crossbar to send
+ * them (see takeBackInvalidations).
  */
 class SnoopFilter : public SimObject {
 public:
@@ -92,11 +103,17 @@ public:
 
     typedef std::vector<QueuedResponsePort *> SnoopList;
 
-    SnoopFilter(const SnoopFilterParams &p) : SimObject(p), reqLookupResult(cachedLocations.end()),
-                                              linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
-                                              maxEntryCount(p.max_capacity * 4 / p.system->cacheLineSize()),
-                                              stats(this) {
-    }
+    SnoopFilter(const SnoopFilterParams &p);
+
+    /**
+     * A line evicted from a bounded snoop filter while caches above
+     * still held it. The holders must be sent an invalidation.
+     */
+    struct BackInvalidation {
+        Addr addr;
+        bool isSecure;
+        SnoopList ports;
+    };
 
     /**
      * Init a new snoop filter and tell it about all the cpu_sideports
@@ -195,6 +212,21 @@ public:
      */
     void updateResponse(const Packet *cpkt, const ResponsePort &cpu_side_port);
 
+    /**
+     * Is the number of tracked lines limited? Only a bounded filter
+     * back-invalidates lines.
+     */
+    bool bounded() const { return !entries.empty(); }
+
+    /** Are there evicted lines whose holders are still to be invalidated? */
+    bool hasBackInvalidations() const { return !backInvalidations.empty(); }
+
+    /**
+     * Hand the pending back-invalidations over to the caller, which is
+     * responsible for sending them to the holders.
+     */
+    std::vector<BackInvalidation> takeBackInvalidations();
+
     virtual void regStats();
 
 protected:
@@ -218,6 +250,15 @@ protected:
      */
     typedef std::unordered_map<Addr, SnoopItem> SnoopFilterCache;
 
+    /** Way of a bounded snoop filter. */
+    struct SnoopEntry : public ReplaceableEntry, public SnoopItem {
+        SnoopEntry() : SnoopItem{0, 0} {}
+
+        /** Line address, including the LineSecure bit. */
+        Addr lineAddr = 0;
+        bool valid = false;
+    };
+
     /**
      * Simple factory methods for standard return values.
      */
@@ -248,14 +289,57 @@ protected:
     SnoopList maskToPortList(SnoopMask ports) const;
 
 private:
+    /**
+     * Find the item tracking a line. In a bounded filter a hit also
+     * updates the replacement state of the line.
+     *
+     * @param line_addr Line address, including the LineSecure bit.
+     * @return The item, or nullptr if the line is not tracked.
+     */
+    SnoopItem *findItem(Addr line_addr);
+
+    /**
+     * Start tracking a line that findItem did not find. In a bounded
+     * filter this may evict another line of the same set, and queue a
+     * back-invalidation of its holders.
+     */
+    SnoopItem *allocateItem(Addr line_addr);
+
     /**
      * Removes snoop filter items which have no requestors and no holders.
      */
-    void eraseIfNullEntry(SnoopFilterCache::iterator &sf_it);
+    void eraseIfNullEntry(Addr line_addr, SnoopItem *sf_item);
 
-    /** Simple hash set of cached addresses. */
+    /**
+     * Holders of a line that was evicted, but whose back-invalidation
+     * was not sent yet. They still have to be snooped, and a line that
+     * is allocated again starts with them as holders.
+     */
+    SnoopMask pendingHolders(Addr line_addr) const;
+
+    /**
+     * Simple hash set of cached addresses. It holds all the lines of an
+     * unbounded filter. In a bounded filter it only holds the lines of
+     * sets where every way has a request in flight, which cannot be
+     * evicted without losing track of the request.
+     */
     SnoopFilterCache cachedLocations;
 
+    /** Ways of a bounded filter, set after set, empty if unbounded. */
+    std::vector<SnoopEntry> entries;
+
+    /** Associativity of a bounded filter. */
+    const unsigned assoc;
+
+    /** Number of sets of a bounded filter. */
+    unsigned numSets;
+
+    /** Replacement policy of a bounded filter. */
+    replacement_policy::Base *replacementPolicy;
+
+    /** Lines evicted by a bounded filter, to be invalidated above. */
+    std::vector<BackInvalidation> backInvalidations;
+
     /**
      * A request lookup must be followed by a call to finishRequest to inform
      * the operation's success. If a retry is needed, however, all changes
@@ -263,26 +347,28 @@ private:
      * This structure keeps track of the state previous to such changes.
      */
     struct ReqLookupResult {
-        /** Iterator used to store the result from lookupRequest. */
-        SnoopFilterCache::iterator it;
+        /** Item found or allocated by lookupRequest, if any. */
+        SnoopItem *item = nullptr;
+
+        /** Line address of the item, including the LineSecure bit. */
+        Addr lineAddr = 0;
 
         /**
          * Variable to temporarily store value of snoopfilter entry
          * in case finishRequest needs to undo changes made in lookupRequest
          * (because of crossbar retry)
          */
-        SnoopItem retryItem;
+        SnoopItem retryItem{0, 0};
 
         /**
-         * The constructor must be informed of the internal cache's end
-         * iterator, so do not allow the compiler to implictly define it.
-         *
-         * @param end_it Iterator to the end of the internal cache.
+         * Whether lookupRequest evicted a line of a bounded filter to
+         * allocate the item. The holders of the evicted line are only
+         * invalidated once the request is accepted, and the line is
+         * tracked again in its way if the request will retry.
          */
-        ReqLookupResult(SnoopFilterCache::iterator end_it)
-            : it(end_it), retryItem{0, 0} {
-        }
-        ReqLookupResult() = delete;
+        bool evicted = false;
+        Addr evictedAddr = 0;
+        SnoopMask evictedHolder = 0;
     } reqLookupResult;
 
     /** List of all attached snooping CPU-side ports. */
@@ -315,6 +401,9 @@ private:
         statistics::Scalar totSnoops;
         statistics::Scalar hitSingleSnoops;
         statistics::Scalar hitMultiSnoops;
+
+        statistics::Scalar backInvalidations;
+        statistics::Scalar overflows;
     } stats;
 };
 
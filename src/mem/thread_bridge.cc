@@ -27,6 +27,8 @@
 
 #include "mem/thread_bridge.hh"
 
+#include "base/cast.hh"
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "sim/eventq.hh"
 
@@ -34,10 +36,28 @@ namespace gem5
 {
 
 ThreadBridge::ThreadBridge(const ThreadBridgeParams &p)
-    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this)
+    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this),
+      inQueue_(getEventQueue(p.in_eventq_index)), delay_(p.delay)
 {
 }
 
+void
+ThreadBridge::init()
+{
+    SimObject::init();
+
+    fatal_if(inQueue_ != eventQueue() && delay_ < simQuantum,
+             "%s: delay (%d) is shorter than the simulation quantum (%d).\n",
+             name(), delay_, simQuantum);
+}
+
+void
+ThreadBridge::crossTo(EventQueue *eq, std::function<void()> callback)
+{
+    eq->schedule(new EventFunctionWrapper(callback, name() + ".cross", true),
+                 curTick() + delay_, true);
+}
+
 ThreadBridge::IncomingPort::IncomingPort(const std::string &name,
                                          ThreadBridge &device)
     : ResponsePort(name), device_(device)
@@ -54,12 +74,53 @@ ThreadBridge::IncomingPort::getAddrRanges() const
 bool
 ThreadBridge::IncomingPort::recvTimingReq(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    // Express snoops are expected to reach every cache before this call
+    // returns, so they cannot be delayed.
+    if (pkt->isExpressSnoop()) {
+        EventQueue::ScopedMigration migrate(device_.eventQueue());
+        [[maybe_unused]] bool success = device_.out_port_.sendTimingReq(pkt);
+        assert(success);
+        return true;
+    }
+
+    if (pkt->needsResponse())
+        pkt->pushSenderState(new BridgeSenderState(curEventQueue()));
+
+    device_.crossTo(device_.eventQueue(),
+                    [this, pkt]{ device_.out_port_.sendReq(pkt); });
+    return true;
 }
+
+bool
+ThreadBridge::IncomingPort::tryTiming(PacketPtr pkt)
+{
+    // Requests are buffered in the bridge, they are always accepted.
+    return true;
+}
+
+bool
+ThreadBridge::IncomingPort::recvTimingSnoopResp(PacketPtr pkt)
+{
+    device_.crossTo(device_.eventQueue(),
+                    [this, pkt]{ device_.out_port_.sendSnoopResp(pkt); });
+    return true;
+}
+
 void
 ThreadBridge::IncomingPort::recvRespRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    while (!respQueue_.empty()) {
+        if (!sendTimingResp(respQueue_.front()))
+            return;
+        respQueue_.pop_front();
+    }
+}
+
+void
+ThreadBridge::IncomingPort::sendResp(PacketPtr pkt)
+{
+    if (!respQueue_.empty() || !sendTimingResp(pkt))
+        respQueue_.push_back(pkt);
 }
 
 // AtomicResponseProtocol
@@ -90,16 +151,81 @@ ThreadBridge::OutgoingPort::recvRangeChange()
     device_.in_port_.sendRangeChange();
 }
 
+bool
+ThreadBridge::OutgoingPort::isSnooping() const
+{
+    return device_.in_port_.isSnooping();
+}
+
 // TimingRequestProtocol
 bool
 ThreadBridge::OutgoingPort::recvTimingResp(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    auto *state = safe_cast<BridgeSenderState *>(pkt->popSenderState());
+    EventQueue *origin = state->origin;
+    delete state;
+
+    device_.crossTo(origin, [this, pkt]{ device_.in_port_.sendResp(pkt); });
+    return true;
 }
+
+void
+ThreadBridge::OutgoingPort::recvTimingSnoopReq(PacketPtr pkt)
+{
+    // The snooper has to respond (or not) before this call returns, so
+    // the snoop is forwarded in place on the queue of the in_port side.
+    EventQueue::ScopedMigration migrate(device_.inQueue_);
+    device_.in_port_.sendTimingSnoopReq(pkt);
+}
+
 void
 ThreadBridge::OutgoingPort::recvReqRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    while (!reqQueue_.empty()) {
+        if (!sendTimingReq(reqQueue_.front()))
+            return;
+        reqQueue_.pop_front();
+    }
+}
+
+void
+ThreadBridge::OutgoingPort::recvRetrySnoopResp()
+{
+    while (!snoopRespQueue_.empty()) {
+        if (!sendTimingSnoopResp(snoopRespQueue_.front()))
+            return;
+        snoopRespQueue_.pop_front();
+    }
+}
+
+void
+ThreadBridge::OutgoingPort::sendReq(PacketPtr pkt)
+{
+    if (!reqQueue_.empty() || !sendTimingReq(pkt))
+        reqQueue_.push_back(pkt);
+}
+
+void
+ThreadBridge::OutgoingPort::sendSnoopResp(PacketPtr pkt)
+{
+    if (!snoopRespQueue_.empty() || !sendTimingSnoopResp(pkt))
+        snoopRespQueue_.push_back(pkt);
+}
+
+// AtomicRequestProtocol
+Tick
+ThreadBridge::OutgoingPort::recvAtomicSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(device_.inQueue_);
+    return device_.in_port_.sendAtomicSnoop(pkt);
+}
+
+// FunctionalRequestProtocol
+void
+ThreadBridge::OutgoingPort::recvFunctionalSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(device_.inQueue_);
+    device_.in_port_.sendFunctionalSnoop(pkt);
 }
 
 Port &
@@ -28,8 +28,13 @@
 #ifndef __MEM_THREAD_BRIDGE_HH__
 #define __MEM_THREAD_BRIDGE_HH__
 
+#include <deque>
+#include <functional>
+
+#include "mem/packet.hh"
 #include "mem/port.hh"
 #include "params/ThreadBridge.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -40,10 +45,22 @@ class ThreadBridge : public SimObject
   public:
     explicit ThreadBridge(const ThreadBridgeParams &p);
 
+    void init() override;
+
     Port &getPort(const std::string &if_name,
                   PortID idx = InvalidPortID) override;
 
   private:
+    /**
+     * Sender state of a timing request crossing the bridge, remembering
+     * the event queue the response has to be delivered to.
+     */
+    struct BridgeSenderState : public Packet::SenderState
+    {
+        EventQueue *origin;
+        explicit BridgeSenderState(EventQueue *_origin) : origin(_origin) {}
+    };
+
     class IncomingPort : public ResponsePort
     {
       public:
@@ -52,6 +69,8 @@ class ThreadBridge : public SimObject
 
         // TimingResponseProtocol
         bool recvTimingReq(PacketPtr pkt) override;
+        bool tryTiming(PacketPtr pkt) override;
+        bool recvTimingSnoopResp(PacketPtr pkt) override;
         void recvRespRetry() override;
 
         // AtomicResponseProtocol
@@ -60,8 +79,14 @@ class ThreadBridge : public SimObject
         // FunctionalResponseProtocol
         void recvFunctional(PacketPtr pkt) override;
 
+        /** Send a response, or queue it until the requestor retries. */
+        void sendResp(PacketPtr pkt);
+
       private:
         ThreadBridge &device_;
+
+        /** Responses waiting for a retry, only touched by the in queue. */
+        std::deque<PacketPtr> respQueue_;
     };
 
     class OutgoingPort : public RequestPort
@@ -69,17 +94,51 @@ class ThreadBridge : public SimObject
       public:
         OutgoingPort(const std::string &name, ThreadBridge &device);
         void recvRangeChange() override;
+        bool isSnooping() const override;
 
         // TimingRequestProtocol
         bool recvTimingResp(PacketPtr pkt) override;
+        void recvTimingSnoopReq(PacketPtr pkt) override;
         void recvReqRetry() override;
+        void recvRetrySnoopResp() override;
+
+        // AtomicRequestProtocol
+        Tick recvAtomicSnoop(PacketPtr pkt) override;
+
+        // FunctionalRequestProtocol
+        void recvFunctionalSnoop(PacketPtr pkt) override;
+
+        /** Send a request, or queue it until the responder retries. */
+        void sendReq(PacketPtr pkt);
+
+        /** Send a snoop response, or queue it until a retry. */
+        void sendSnoopResp(PacketPtr pkt);
 
       private:
         ThreadBridge &device_;
+
+        /** Requests waiting for a retry, only touched by the out queue. */
+        std::deque<PacketPtr> reqQueue_;
+
+        /** Snoop responses waiting for a retry, same as above. */
+        std::deque<PacketPtr> snoopRespQueue_;
     };
 
+    /**
+     * Run a callback on the given event queue after the bridge delay.
+     * The event is inserted as a global event so that it is safe to call
+     * this from any thread.
+     */
+    void crossTo(EventQueue *eq, std::function<void()> callback);
+
     IncomingPort in_port_;
     OutgoingPort out_port_;
+
+    /** Event queue of the objects connected to the in_port. */
+    EventQueue *inQueue_;
+
+    /** Latency of timing packets crossing the bridge. */
+    const Tick delay_;
 };
 
 }  // namespace gem5
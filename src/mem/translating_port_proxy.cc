@@ -110,6 +110,21 @@ TranslatingPortProxy::tryWriteBlob(
     });
 }
 
+bool
+TranslatingPortProxy::tryWriteFileBlob(Addr addr, const void *p,
+        uint64_t size, int fd, off_t offset) const
+{
+    constexpr auto mode = BaseMMU::Write;
+    return tryOnBlob(mode, _tc->getMMUPtr()->translateFunctional(
+            addr, size, _tc, mode, flags),
+        [this, &p, fd, &offset](const auto &range) {
+            PortProxy::writeFileBlobPhys(range.paddr, flags, p, range.size,
+                                         fd, offset);
+            p = static_cast<const uint8_t *>(p) + range.size;
+            offset += range.size;
+    });
+}
+
 bool
 TranslatingPortProxy::tryMemsetBlob(Addr addr, uint8_t v, uint64_t size) const
 {
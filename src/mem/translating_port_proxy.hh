@@ -87,6 +87,11 @@ class TranslatingPortProxy : public PortProxy
      * Fill size bytes starting at addr with byte value val.
      */
     bool tryMemsetBlob(Addr address, uint8_t  v, uint64_t size) const override;
+
+    /** Version of tryWriteFileBlob that translates virt->phys and maps
+      * every translated range on its own. */
+    bool tryWriteFileBlob(Addr addr, const void *p, uint64_t size,
+                          int fd, off_t offset) const override;
 };
 
 } // namespace gem5
@@ -227,6 +227,14 @@ def parse_options():
         default="stats.txt",
         help="Sets the output file for statistics [Default: %default]",
     )
+    option(
+        "--stats-level",
+        metavar="LEVEL",
+        default="full",
+        choices=["none", "basic", "full"],
+        help="Amount of statistics maintained on hot paths: none, basic "
+        "or full [Default: %default]",
+    )
     option(
         "--stats-help",
         action="callback",
@@ -282,6 +290,14 @@ def parse_options():
         split=",",
         help="Sets the flags for debug output (-FLAG disables a flag)",
     )
+    option(
+        "--profile-events",
+        metavar="NAME",
+        default=None,
+        help="Profile the host time spent in every event and SimObject and "
+        "write NAME.txt and NAME.folded (flame graph input) to the output "
+        "directory at exit",
+    )
     option(
         "--debug-start",
         metavar="TICK",
@@ -558,6 +574,10 @@ def main():
 
     # set stats options
     stats.addStatVisitor(options.stats_file)
+    stats.setLevel(options.stats_level)
+
+    if options.profile_events:
+        event.enableProfiler(options.profile_events)
 
     # Disable listeners unless running interactively or explicitly
     # enabled
@@ -153,6 +153,23 @@ def _textFactory(fn, desc=True, spaces=True):
     return _m5.stats.initText(fn, desc, spaces)
 
 
+@_url_factory(["bin"])
+def _binaryFactory(fn):
+    """Output stats in an append-only, columnar binary format.
+
+    Each stat element is stored as a column. Every dump only records
+    the columns that changed since the previous dump, which makes
+    frequent periodic dumps of large systems cheap compared to the text
+    format. Use util/decode_stats_bin.py to read the file back.
+
+    Example:
+      bin://stats.bin
+
+    """
+
+    return _m5.stats.initBinary(fn)
+
+
 @_url_factory(["h5"], enable=hasattr(_m5.stats, "initHDF5"))
 def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
     """Output stats in HDF5 format.
@@ -234,6 +251,24 @@ def addStatVisitor(url):
     outputList.append(factory(parsed))
 
 
+# Statistics levels, see src/base/stats/level.hh
+_stat_levels = {"none": 0, "basic": 1, "full": 2}
+
+
+def setLevel(level):
+    """Set the amount of statistics maintained on hot paths
+
+    Levels are "none", "basic" (aggregate counters only) and "full"
+    (the default). Builds with a lower STATS_MAX_LEVEL silently clamp
+    the level.
+
+    """
+
+    if level not in _stat_levels:
+        fatal(f"Unknown stats level '{level}'")
+    _m5.stats.setLevel(_stat_levels[level])
+
+
 def printStatVisitorTypes():
     """List available stat visitors and their documentation"""
 
@@ -44,6 +44,7 @@
 #include "pybind11/stl.h"
 
 #include "base/logging.hh"
+#include "sim/event_profiler.hh"
 #include "sim/eventq.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
@@ -110,6 +111,7 @@ pybind_init_event(py::module_ &m_native)
     m.def("setMaxTick", &set_max_tick, py::arg("tick"));
     m.def("getMaxTick", &get_max_tick, py::return_value_policy::copy);
     m.def("terminateEventQueueThreads", &terminateEventQueueThreads);
+    m.def("enableProfiler", &event_profiler::enable, py::arg("name"));
     m.def("exitSimLoop", &exitSimLoop);
     m.def("getEventQueue", []() { return curEventQueue(); },
           py::return_value_policy::reference);
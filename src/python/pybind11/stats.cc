@@ -42,6 +42,8 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/level.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -111,9 +113,14 @@ pybind_init_stats(py::module_ &m_native)
         .def("initSimStats", &statistics::initSimStats)
         .def("initText", &statistics::initText,
             py::return_value_policy::reference)
+        .def("initBinary", &statistics::initBinary,
+            py::return_value_policy::reference)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
+        .def("setLevel", [](int level) {
+                statistics::setLevel(static_cast<statistics::Level>(level));
+            })
         .def("registerPythonStatsHandlers",
              &statistics::registerPythonStatsHandlers)
         .def("schedStatEvent", &statistics::schedStatEvent)
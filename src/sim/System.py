@@ -79,6 +79,14 @@ class System(SimObject):
         False, "mmap the backing store without reserving swap"
     )
 
+    # Loadable segments of workload images can be mapped copy-on-write
+    # from their file rather than copied into the backing store, so that
+    # simulations loading the same binary share its pages on the host
+    # until the guest writes them.
+    cow_image_segments = Param.Bool(
+        False, "mmap file-backed image segments copy-on-write"
+    )
+
     # The memory ranges are to be populated when creating the system
     # such that these can be passed from the I/O subsystem through an
     # I/O bridge or cache
@@ -0,0 +1,204 @@
+#include "sim/event_profiler.hh"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "sim/core.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace event_profiler
+{
+
+bool _enabled = false;
+
+namespace
+{
+
+std::string reportName;
+
+/** Serializes the creation of entries by the event queue threads. */
+std::mutex entriesMutex;
+
+/** Entries of attributed events by name and description. Never freed. */
+std::unordered_map<std::string, std::unique_ptr<Entry>> entries;
+
+/**
+ * Entries of unattributed events by description. Their names are usually
+ * the default ones, unique to each event object, so they are aggregated
+ * per type of event instead. Never freed.
+ */
+std::unordered_map<std::string, std::unique_ptr<Entry>> unattributed;
+
+/**
+ * Split an event name into the longest prefix that names a SimObject and
+ * the remaining label.
+ */
+void
+attribute(const std::string &name, std::string &object, std::string &label)
+{
+    for (auto dot = name.size(); dot != std::string::npos;
+         dot = dot ? name.rfind('.', dot - 1) : std::string::npos) {
+        const std::string prefix = name.substr(0, dot);
+        if (!prefix.empty() && SimObject::find(prefix.c_str())) {
+            object = prefix;
+            label = dot < name.size() ? name.substr(dot + 1) : "";
+            return;
+        }
+    }
+    object.clear();
+    label = name;
+}
+
+const char *
+unit()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return "TSC cycles";
+#else
+    return "ns";
+#endif
+}
+
+} // anonymous namespace
+
+void
+enable(const std::string &name)
+{
+    if (_enabled)
+        return;
+
+    reportName = name;
+    _enabled = true;
+    registerExitCallback([]() { dump(); });
+}
+
+Entry *
+lookup(const Event &event)
+{
+    const std::string name = event.name();
+    const char *description = event.description();
+    const std::string key = name + '\0' + description;
+
+    std::lock_guard<std::mutex> lock(entriesMutex);
+    auto it = entries.find(key);
+    if (it != entries.end())
+        return it->second.get();
+
+    std::string object, label;
+    attribute(name, object, label);
+    if (object.empty()) {
+        auto &entry = unattributed[description];
+        if (!entry) {
+            entry = std::make_unique<Entry>();
+            entry->event = description;
+        }
+        return entry.get();
+    }
+
+    auto &entry = entries[key];
+    entry = std::make_unique<Entry>();
+    entry->object = object;
+    entry->event = label.empty() ? description : label;
+    return entry.get();
+}
+
+void
+dump()
+{
+    std::lock_guard<std::mutex> lock(entriesMutex);
+
+    struct Total
+    {
+        uint64_t cycles = 0;
+        uint64_t count = 0;
+    };
+
+    std::vector<const Entry *> sorted;
+    std::map<std::string, Total> objects;
+    Total total;
+    for (const auto *map : {&entries, &unattributed}) {
+        for (const auto &[key, entry] : *map) {
+            const uint64_t cycles = entry->cycles.load();
+            const uint64_t count = entry->count.load();
+            if (!count)
+                continue;
+            sorted.push_back(entry.get());
+            Total &object = objects[entry->object];
+            object.cycles += cycles;
+            object.count += count;
+            total.cycles += cycles;
+            total.count += count;
+        }
+    }
+
+    std::sort(sorted.begin(), sorted.end(),
+        [](const Entry *a, const Entry *b) {
+            return a->cycles.load() > b->cycles.load();
+        });
+
+    std::vector<std::pair<std::string, Total>> by_object(
+        objects.begin(), objects.end());
+    std::sort(by_object.begin(), by_object.end(),
+        [](const auto &a, const auto &b) {
+            return a.second.cycles > b.second.cycles;
+        });
+
+    auto percent = [&total](uint64_t cycles) {
+        return total.cycles ? 100.0 * cycles / total.cycles : 0.0;
+    };
+    auto object_name = [](const std::string &object) {
+        return object.empty() ? std::string("(unattributed)") : object;
+    };
+
+    OutputStream *report = simout.create(reportName + ".txt");
+    std::ostream &os = *report->stream();
+    ccprintf(os, "# Host time of %d events: %d %s\n\n", total.count,
+             total.cycles, unit());
+
+    ccprintf(os, "# Per SimObject\n");
+    ccprintf(os, "%-50s %16s %7s %12s %10s\n",
+             "object", "time", "%", "events", "time/event");
+    for (const auto &[object, t] : by_object) {
+        ccprintf(os, "%-50s %16d %6.2f%% %12d %10.1f\n",
+                 object_name(object), t.cycles, percent(t.cycles), t.count,
+                 (double)t.cycles / t.count);
+    }
+
+    ccprintf(os, "\n# Per event\n");
+    ccprintf(os, "%-50s %-30s %16s %7s %12s %10s\n",
+             "object", "event", "time", "%", "events", "time/event");
+    for (const Entry *entry : sorted) {
+        const uint64_t cycles = entry->cycles.load();
+        const uint64_t count = entry->count.load();
+        ccprintf(os, "%-50s %-30s %16d %6.2f%% %12d %10.1f\n",
+                 object_name(entry->object), entry->event, cycles,
+                 percent(cycles), count, (double)cycles / count);
+    }
+    simout.close(report);
+
+    OutputStream *folded = simout.create(reportName + ".folded");
+    std::ostream &fs = *folded->stream();
+    for (const Entry *entry : sorted) {
+        std::string stack = object_name(entry->object);
+        std::replace(stack.begin(), stack.end(), '.', ';');
+        std::string event = entry->event;
+        std::replace(event.begin(), event.end(), ' ', '_');
+        std::replace(event.begin(), event.end(), ';', '_');
+        ccprintf(fs, "%s;%s %d\n", stack, event, entry->cycles.load());
+    }
+    simout.close(folded);
+}
+
+} // namespace event_profiler
+} // namespace gem5
@@ -0,0 +1,97 @@
+#ifndef __SIM_EVENT_PROFILER_HH__
+#define __SIM_EVENT_PROFILER_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace gem5
+{
+
+class Event;
+
+/**
+ * Opt-in host profiler of the event queues. When enabled, every event
+ * serviced by EventQueue::serviceOne() is timed on the host and the time
+ * is accumulated per event and per SimObject. The SimObject of an event
+ * is the longest dot-separated prefix of the event name that names a
+ * SimObject (e.g., "system.cpu0" for "system.cpu0.tickEvent"). Events
+ * without such a prefix are aggregated by description. At exit
+ * two files are written to the output directory:
+ *
+ *   <name>.txt     Host time per SimObject and per event, sorted by time.
+ *   <name>.folded  One "object;path;event count" line per event, the
+ *                  folded stack format read by flamegraph.pl.
+ *
+ * Host time is measured in TSC cycles on x86 hosts and in nanoseconds
+ * elsewhere. Only the time spent in Event::process() is accounted, the
+ * event queue bookkeeping itself is not.
+ */
+namespace event_profiler
+{
+
+/**
+ * Accumulated host time of the events sharing a name and description, or
+ * only a description if they are not attributed to a SimObject.
+ */
+struct Entry
+{
+    /** SimObject the events are attributed to, empty if none matched. */
+    std::string object;
+    /** Event label: the rest of the event name or its description. */
+    std::string event;
+
+    std::atomic<uint64_t> cycles{0};
+    std::atomic<uint64_t> count{0};
+
+    void
+    record(uint64_t delta)
+    {
+        cycles.fetch_add(delta, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+extern bool _enabled;
+
+/** Whether events are being profiled. */
+inline bool enabled() { return _enabled; }
+
+/**
+ * Start profiling events, and write the reports at exit.
+ *
+ * @param name Base name of the report files in the output directory.
+ */
+void enable(const std::string &name);
+
+/**
+ * Get the entry an event is accounted to, creating it the first time an
+ * event with this name and description, or this description if the
+ * event is not attributed to a SimObject, is seen.
+ */
+Entry *lookup(const Event &event);
+
+/** Write the reports. Called at exit when profiling is enabled. */
+void dump();
+
+/** Current value of the host time counter. */
+inline uint64_t
+hostCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+} // namespace event_profiler
+} // namespace gem5
+
+#endif // __SIM_EVENT_PROFILER_HH__
@@ -31,6 +31,7 @@
 #include "sim/eventq.hh"
 
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <mutex>
 #include <string>
@@ -41,6 +42,7 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/event_profiler.hh"
 
 namespace gem5
 {
@@ -64,7 +66,8 @@ getEventQueue(uint32_t index)
     while (numMainEventQueues <= index) {
         numMainEventQueues++;
         mainEventQueue.push_back(
-            new EventQueue(csprintf("MainEventQueue-%d", index)));
+            new EventQueue(csprintf("MainEventQueue-%d", index),
+                           numMainEventQueues - 1));
     }
 
     return mainEventQueue[index];
@@ -246,7 +249,17 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (event_profiler::enabled()) {
+            if (!event->profileEntry)
+                event->profileEntry = event_profiler::lookup(*event);
+            // The event may be gone once processed
+            event_profiler::Entry *entry = event->profileEntry;
+            const uint64_t start = event_profiler::hostCycles();
+            event->process();
+            entry->record(event_profiler::hostCycles() - start);
+        } else {
+            event->process();
+        }
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -441,16 +454,22 @@ Event::dump() const
     }
 }
 
-EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+EventQueue::EventQueue(const std::string &n, uint32_t index)
+    : objName(n), head(NULL), _curTick(0), index(index)
 {
 }
 
 void
 EventQueue::asyncInsert(Event *event)
 {
+    // The rank of the event is only deterministic when it is added by a
+    // simulation thread, which is the only one adding with its queue
+    EventQueue *source = curEventQueue();
+    AsyncEvent async_event{event, source ? source->index : UINT32_MAX,
+                           source ? source->asyncSeq++ : 0};
+
     async_queue_mutex.lock();
-    async_queue.push_back(event);
+    async_queue.push_back(async_event);
     async_queue_mutex.unlock();
 }
 
@@ -460,8 +479,14 @@ EventQueue::handleAsyncInsertions()
     assert(this == curEventQueue());
     async_queue_mutex.lock();
 
+    // Events of a same tick and priority are serviced in the order they
+    // are inserted, which must not depend on the timing of the threads
+    async_queue.sort([](const AsyncEvent &a, const AsyncEvent &b) {
+        return a.source != b.source ? a.source < b.source : a.seq < b.seq;
+    });
+
     while (!async_queue.empty()) {
-        insert(async_queue.front());
+        insert(async_queue.front().event);
         async_queue.pop_front();
     }
 
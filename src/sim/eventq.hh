@@ -61,6 +61,11 @@ namespace gem5
 class EventQueue;       // forward declaration
 class BaseGlobalEvent;
 
+namespace event_profiler
+{
+struct Entry;
+} // namespace event_profiler
+
 //! Simulation Quantum for multiple eventq simulation.
 //! The quantum value is the period length after which the queues
 //! synchronize themselves with each other. This means that any
@@ -275,6 +280,10 @@ class Event : public EventBase, public Serializable
     Priority _priority; //!< event priority
     Flags flags;
 
+    /// Host profiler entry this event is accounted to, looked up the
+    /// first time the event is serviced with profiling enabled.
+    event_profiler::Entry *profileEntry;
+
 #ifndef NDEBUG
     /// Global counter to generate unique IDs for Event instances
     static Counter instanceCounter;
@@ -406,7 +415,7 @@ class Event : public EventBase, public Serializable
      */
     Event(Priority p = Default_Pri, Flags f = 0)
         : nextBin(nullptr), nextInBin(nullptr), _when(0), _priority(p),
-          flags(Initialized | f)
+          flags(Initialized | f), profileEntry(nullptr)
     {
         assert(f.noneSet(~PublicWrite));
 #ifndef NDEBUG
@@ -607,7 +616,10 @@ operator!=(const Event &l, const Event &r)
  * deterministic. This causes the event to be inserted in a separate
  * queue of asynchronous events (async_queue), which is merged main
  * event queue at the end of each simulation quantum (by calling the
- * handleAsyncInsertions() method). Note that this implies that such
+ * handleAsyncInsertions() method). The events are merged in the order of
+ * the index of the queue that scheduled them, then in the order that
+ * queue scheduled them, rather than in the order they reached the
+ * async_queue. Note that this implies that such
  * events must happen at least one simulation quantum into the future,
  * otherwise they risk being scheduled in the past by
  * handleAsyncInsertions().
@@ -624,8 +636,24 @@ class EventQueue
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
+    //! An event added by another thread, with the index of the queue of
+    //! that thread and the rank of the event among those it added.
+    struct AsyncEvent
+    {
+        Event *event;
+        uint32_t source;
+        uint64_t seq;
+    };
+
     //! List of events added by other threads to this event queue.
-    std::list<Event*> async_queue;
+    std::list<AsyncEvent> async_queue;
+
+    //! Index of the queue among the main event queues.
+    const uint32_t index;
+
+    //! Number of events the thread of this queue added to the async
+    //! queues of other queues.
+    uint64_t asyncSeq = 0;
 
     /**
      * Lock protecting event handling.
@@ -738,7 +766,7 @@ class EventQueue
     /**
      * @ingroup api_eventq
      */
-    EventQueue(const std::string &n);
+    EventQueue(const std::string &n, uint32_t index = 0);
 
     /**
      * @ingroup api_eventq
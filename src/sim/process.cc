@@ -300,6 +300,7 @@ Process::initState()
 
     initVirtMem.reset(new SETranslatingPortProxy(
                 tc, SETranslatingPortProxy::Always));
+    system->setupFileMapper(*initVirtMem);
 
     // load object file into target memory
     image.write(*initVirtMem);
@@ -51,6 +51,7 @@
 #include <string>
 #include <vector>
 
+#include "arch/generic/mmu.hh"
 #include "base/debug.hh"
 #include "base/output.hh"
 #include "cpu/base.hh"
@@ -60,6 +61,7 @@
 #include "debug/Quiesce.hh"
 #include "debug/WorkItems.hh"
 #include "dev/net/dist_iface.hh"
+#include "mem/coherent_xbar.hh"
 #include "mem/se_translating_port_proxy.hh"
 #include "mem/translating_port_proxy.hh"
 #include "params/BaseCPU.hh"
@@ -565,6 +567,46 @@ void clearmemregion(ThreadContext *tc) {
     static_cast<gem5::o3::CPU *>(tc->getCpuPtr())->clearMemRegion();
 }
 
+void flushrange(ThreadContext *tc, Addr start, Addr end, uint64_t invalidate) {
+    DPRINTF(PseudoInst, "pseudo_inst::flushrange(0x%x, 0x%x, %d)\n", start, end, invalidate);
+    if (end <= start)
+        return;
+
+    const auto &coherence_points = tc->getSystemPtr()->getCoherencePoints();
+    if (coherence_points.empty()) {
+        warn_once("m5_flush_range: no point of coherency crossbar to flush the caches from");
+        return;
+    }
+
+    // Send one operation per physically contiguous piece of the range
+    Addr paddr = 0;
+    Addr size = 0;
+    auto flush = [&]() {
+        if (size == 0)
+            return;
+        for (auto *xbar : coherence_points)
+            xbar->maintainRange(paddr, size, invalidate);
+    };
+
+    auto gen = tc->getMMUPtr()->translateFunctional(start, end - start, tc, BaseMMU::Read, 0);
+    for (const auto &range : *gen) {
+        if (range.fault != NoFault) {
+            // Pages that are not mapped cannot be cached
+            flush();
+            size = 0;
+            continue;
+        }
+        if (size != 0 && paddr + size == range.paddr) {
+            size += range.size;
+        } else {
+            flush();
+            paddr = range.paddr;
+            size = range.size;
+        }
+    }
+    flush();
+}
+
 // int *m5MAAload(ThreadContext *tc, int *a, int *b, int min, int max) {
 //     DPRINTF(PseudoInst, "pseudo_inst::m5MAAload()\n");
 //     gem5::BaseCPU *cpu = tc->getCpuPtr();
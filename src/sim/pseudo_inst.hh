@@ -90,6 +90,7 @@ void togglesync(ThreadContext *tc);
 void triggerWorkloadEvent(ThreadContext *tc);
 void addmemregion(ThreadContext *tc, Addr start, Addr end, uint64_t id);
 void clearmemregion(ThreadContext *tc);
+void flushrange(ThreadContext *tc, Addr start, Addr end, uint64_t invalidate);
 // uint64_t m5MAAload(ThreadContext *tc, int *a, int *b, int min, int max);
 
 /**
@@ -233,6 +234,10 @@ bool pseudoInstWork(ThreadContext *tc, uint8_t func, uint64_t &result) {
         invokeSimcall<ABI>(tc, clearmemregion);
         return true;
 
+    case M5OP_FLUSH_RANGE:
+        invokeSimcall<ABI>(tc, flushrange);
+        return true;
+
         // case M5OP_MAA_LOAD:
         //     result = invokeSimcall<ABI, store_ret, int *>(tc, m5MAAload);
         //     return true;
@@ -187,6 +187,8 @@ System::System(const Params &p)
             "(could use StubWorkload?).", name());
     workload->setSystem(this);
 
+    setupFileMapper(physProxy);
+
     // add self to global system list
     systemList.push_back(this);
 
@@ -278,6 +280,18 @@ System::replaceThreadContext(ThreadContext *tc, ContextID context_id)
     }
 }
 
+void
+System::setupFileMapper(PortProxy &proxy)
+{
+    if (!params().cow_image_segments)
+        return;
+
+    proxy.setFileMapper(
+        [this](Addr addr, int fd, off_t offset, uint64_t size) {
+            return physmem.mapFile(addr, fd, offset, size);
+        }, physmem.hostPageSize());
+}
+
 Addr
 System::memSize() const
 {
@@ -67,6 +67,7 @@
 namespace gem5 {
 
 class BaseRemoteGDB;
+class CoherentXBar;
 class KvmVM;
 class ThreadContext;
 
@@ -314,10 +315,28 @@ public:
      */
     void setKvmVM(KvmVM *const vm) { kvmVM = vm; }
 
+    /**
+     * Get the crossbars that are a point of coherency, through which
+     * the caches of the system can be flushed.
+     */
+    const std::vector<CoherentXBar *> &getCoherencePoints() const { return coherencePoints; }
+
+    /**
+     * Register a point of coherency crossbar. For use by the crossbar to
+     * declare itself to the system.
+     */
+    void addCoherencePoint(CoherentXBar *xbar) { coherencePoints.push_back(xbar); }
+
     /** Get a pointer to access the physical memory of the system */
     memory::PhysicalMemory &getPhysMem() { return physmem; }
     const memory::PhysicalMemory &getPhysMem() const { return physmem; }
 
+    /**
+     * Let proxy map file-backed image segments copy-on-write into the
+     * physical memory, if the system is configured to.
+     */
+    void setupFileMapper(PortProxy &proxy);
+
     /** Amount of physical memory that exists */
     Addr memSize() const;
 
@@ -373,6 +392,8 @@ public:
 protected:
     KvmVM *kvmVM = nullptr;
 
+    std::vector<CoherentXBar *> coherencePoints;
+
     memory::PhysicalMemory physmem;
 
     AddrRangeList ShadowRomRanges;
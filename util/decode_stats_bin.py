@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+
+# Reader for the columnar binary stats output (bin://stats.bin), see
+# src/base/stats/binary.hh for the file format.
+#
+# Usage:
+#   decode_stats_bin.py stats.bin                  # last dump as text
+#   decode_stats_bin.py stats.bin --dump 3         # fourth dump as text
+#   decode_stats_bin.py stats.bin --csv out.csv --stats 'ipc|numCycles'
+#
+# The StatsBinReader class can also be imported to iterate over the dumps
+# from Python.
+
+import argparse
+import re
+import struct
+import sys
+
+MAGIC = b"GEM5STAT"
+VERSION = 1
+
+
+class StatsBinReader:
+    def __init__(self, path):
+        self.path = path
+        # Column id -> full stat name
+        self.names = {}
+
+    def _read(self, f, fmt):
+        size = struct.calcsize(fmt)
+        data = f.read(size)
+        if len(data) != size:
+            raise EOFError(f"{self.path}: truncated record")
+        return struct.unpack(fmt, data)
+
+    def deltas(self):
+        """Yield (tick, {column id: value}) for every dump, holding only
+        the columns that changed in that dump."""
+        with open(self.path, "rb") as f:
+            if f.read(len(MAGIC)) != MAGIC:
+                raise ValueError(f"{self.path}: not a binary stats file")
+            (version,) = self._read(f, "<I")
+            if version != VERSION:
+                raise ValueError(
+                    f"{self.path}: unsupported version {version}"
+                )
+
+            while True:
+                kind = f.read(1)
+                if not kind:
+                    return
+                if kind == b"S":
+                    (count,) = self._read(f, "<I")
+                    for _ in range(count):
+                        column, length = self._read(f, "<II")
+                        self.names[column] = f.read(length).decode()
+                elif kind == b"D":
+                    tick, count = self._read(f, "<QI")
+                    ids = self._read(f, f"<{count}I")
+                    values = self._read(f, f"<{count}d")
+                    yield tick, dict(zip(ids, values))
+                else:
+                    raise ValueError(f"{self.path}: bad record {kind!r}")
+
+    def dumps(self):
+        """Yield (tick, {stat name: value}) holding the full state of all
+        stats at every dump."""
+        state = {}
+        for tick, delta in self.deltas():
+            state.update(delta)
+            yield tick, {self.names[c]: v for c, v in state.items()}
+
+
+def _format(value):
+    return f"{int(value)}" if value.is_integer() else f"{value:.6f}"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode a binary gem5 stats file"
+    )
+    parser.add_argument("input", help="Binary stats file")
+    parser.add_argument(
+        "--dump", type=int, default=-1, help="Dump to print (default: last)"
+    )
+    parser.add_argument(
+        "--stats", type=str, default=None, help="Regex of stats to output"
+    )
+    parser.add_argument(
+        "--csv",
+        type=str,
+        default=None,
+        help="Write the selected stats of every dump as CSV",
+    )
+    args = parser.parse_args()
+
+    reader = StatsBinReader(args.input)
+    pattern = re.compile(args.stats) if args.stats else None
+
+    def selected(name):
+        return pattern is None or pattern.search(name)
+
+    if args.csv:
+        dumps = list(reader.dumps())
+        columns = sorted(
+            {name for _, stats in dumps for name in stats if selected(name)}
+        )
+        with open(args.csv, "w") as out:
+            out.write(",".join(["tick"] + columns) + "\n")
+            for tick, stats in dumps:
+                row = [str(tick)] + [
+                    _format(stats[c]) if c in stats else "" for c in columns
+                ]
+                out.write(",".join(row) + "\n")
+        return
+
+    dumps = list(reader.dumps())
+    if not dumps:
+        print(f"{args.input}: no dumps", file=sys.stderr)
+        exit(1)
+    tick, stats = dumps[args.dump]
+    print(f"# tick {tick}")
+    for name, value in sorted(stats.items()):
+        if selected(name):
+            print(f"{name:<60} {_format(value)}")
+
+
+if __name__ == "__main__":
+    main()